@@ -20,12 +20,18 @@ AdministradorRegistros::AdministradorRegistros(){
 std::vector<Registro> AdministradorRegistros::obtenerLinea(std::string direccionArch){
     std::string mes, dia, horas, minutos, segundos, direccionIp, puerto, error;
     std::ifstream archivo(direccionArch);
+    TraceScope traceLectura("obtenerLinea");
+    Tracer &tracer = Tracer::getInstance();
+    const int registrosPorBloque = 4096;
+    int registrosLeidos = 0;
 
     if (!archivo.is_open()){
         throw std::invalid_argument("No fue posible acceder al archivo.");
     }
 
     else{
+        tracer.begin("obtenerLinea: bloque 0");
+
         while (std::getline(archivo, mes, ' ') &&
                std::getline(archivo, dia, ' ') &&
                std::getline(archivo, horas, ':') &&
@@ -37,8 +43,16 @@ std::vector<Registro> AdministradorRegistros::obtenerLinea(std::string direccion
         {
             Registro registroTemp(mes, dia, horas, minutos, segundos, direccionIp, puerto, error);
             listaRegistros.push_back(registroTemp);
+            registrosLeidos++;
+
+            if (registrosLeidos % registrosPorBloque == 0 && tracer.isEnabled()){
+                tracer.end("obtenerLinea: bloque");
+                tracer.begin("obtenerLinea: bloque " + std::to_string(registrosLeidos / registrosPorBloque));
+            }
         }
 
+        tracer.end("obtenerLinea: bloque");
+        MemoryTracker::getInstance().setNumRecords((long long)listaRegistros.size());
         archivo.close();
         return listaRegistros;
     }
@@ -102,61 +116,3 @@ Registro AdministradorRegistros::ingresarDatos(int intervalo){
         exit(EXIT_FAILURE);
     }
 }
-
-/*
- * Realiza un ordenamiento de un vector de objetos de la clase Registros
- * utilizando el método seleccionado por el usuario (Burbuja o Merge Sort).
- * El ordenamiento lo hace con base en las fechas.
- * Finalmente, muestra información sobre el número de comparaciones e
- * intercambios realizados durante el proceso de ordenamiento.
- * 
- * @vectorFechas, vector de objetos de la clase Registros donde cada objeto 
- * posee los datos de cada línea del archivo bitacora.txt
- * 
- * @vectorFecha, el mismo vector tras haber sido ordenado. 
- * 
- * Complejidad temporal: es dominada por el algoritmo de ordenamiento que
- * el usuario seleccione. Si se elige ordenamiento Burbuja ---> O(n^2)
- * Si se elige el ordenamiento Merge Sort ---> O(n log n)
- */
-
-std::vector<Registro> AdministradorRegistros::ordenaVector(std::vector<Registro> &vectorFechas){
-    int eleccionOrd;
-    unsigned int comparaciones = 0;
-    unsigned int intercambios = 0;
-    std::vector<Registro> vectorFechasOrd;
-    Registro ordenar;
-    std::cout<<"Ingrese el tipo de ordenamiento que desee: 1 = Burbuja. 2 = Merge Sort" << "----> ";
-    std::cin >> eleccionOrd;
-    std::cout << std::endl;
-
-    if (eleccionOrd == 1){
-        ordenar.ordenaBurbuja(vectorFechas, comparaciones, intercambios);
-        std::cout << "* Informacion Relativa al ordenamiento *" << std::endl;
-        std::cout << "<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<" << std::endl;
-        std::cout << "El numero de comparaciones en el ordenamiento Burbuja fue de: ";
-        std::cout << comparaciones << std::endl;
-        std::cout << "El numero de intercambios en el ordenamiento Burbuja fue de: ";
-        std::cout << intercambios << std::endl;
-        std::cout << "<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<\n" << std::endl;
-        return vectorFechas;
-    }
-
-    else if (eleccionOrd == 2){
-        ordenar.ordenaMerge(vectorFechas, 0, (int)vectorFechas.size() - 1, comparaciones, intercambios);
-        std::cout << "* Informacion Relativa al ordenamiento *" << std::endl;
-        std::cout << "<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<" << std::endl;
-        std::cout << "El numero de comparaciones en el ordenamiento Merge Sort fue de: ";
-        std::cout << comparaciones << std::endl;
-        std::cout << "Merge sort no tiene intercambios, por lo tanto, el numero de intercambios en el ordenamiento fue de: ";
-        std::cout << intercambios << std::endl;
-        std::cout << "<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<\n" << std::endl;
-        return vectorFechas;
-    }
-
-    else{
-        throw std::invalid_argument("Tipo de ordenamiento no existente.");
-    }
-
-}
-
@@ -9,6 +9,9 @@
 #include <sstream>
 #include <limits>
 #include "Registro.h"
+#include "Estadisticas.h"
+#include "Tracer.h"
+#include "PerfCounters.h"
 
 class AdministradorRegistros{
     private:
@@ -18,8 +21,88 @@ class AdministradorRegistros{
         AdministradorRegistros();
         std::vector<Registro> obtenerLinea(std::string direccionArch);
         Registro ingresarDatos (int intervalo);
+        template <class Stats = CountingStats>
         std::vector<Registro> ordenaVector(std::vector<Registro> &vectorFechas);
 };
 
+/*
+ * Realiza un ordenamiento de un vector de objetos de la clase Registros
+ * utilizando el método seleccionado por el usuario (Burbuja o Merge Sort).
+ * El ordenamiento lo hace con base en las fechas.
+ * Finalmente, si la política de conteo lo permite, muestra información sobre
+ * el número de comparaciones e intercambios realizados durante el proceso de
+ * ordenamiento.
+ *
+ * @Stats, parámetro de plantilla que indica la política de conteo. Con
+ * CountingStats (valor predeterminado) se reportan las comparaciones e
+ * intercambios; con NoStats el ordenamiento no cuenta nada y no se imprime
+ * el reporte.
+ * 
+ * @vectorFechas, vector de objetos de la clase Registros donde cada objeto 
+ * posee los datos de cada línea del archivo bitacora.txt
+ * 
+ * @vectorFecha, el mismo vector tras haber sido ordenado. 
+ * 
+ * Complejidad temporal: es dominada por el algoritmo de ordenamiento que
+ * el usuario seleccione. Si se elige ordenamiento Burbuja ---> O(n^2)
+ * Si se elige el ordenamiento Merge Sort ---> O(n log n)
+ */
+
+template <class Stats>
+std::vector<Registro> AdministradorRegistros::ordenaVector(std::vector<Registro> &vectorFechas){
+    int eleccionOrd;
+    Stats estadisticas;
+    std::vector<Registro> vectorFechasOrd;
+    Registro ordenar;
+    std::cout<<"Ingrese el tipo de ordenamiento que desee: 1 = Burbuja. 2 = Merge Sort" << "----> ";
+    std::cin >> eleccionOrd;
+    std::cout << std::endl;
+
+    if (eleccionOrd == 1){
+        {
+            TraceScope traceOrdena("ordenaBurbuja");
+            PerfScope perfOrdena("ordenaBurbuja");
+            ordenar.ordenaBurbuja(vectorFechas, estadisticas);
+        }
+
+        if constexpr (Stats::activo){
+            std::cout << "* Informacion Relativa al ordenamiento *" << std::endl;
+            std::cout << "<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<" << std::endl;
+            std::cout << "El numero de comparaciones en el ordenamiento Burbuja fue de: ";
+            std::cout << estadisticas.obtenerComparaciones() << std::endl;
+            std::cout << "El numero de intercambios en el ordenamiento Burbuja fue de: ";
+            std::cout << estadisticas.obtenerIntercambios() << std::endl;
+            std::cout << "<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<\n" << std::endl;
+        }
+
+        return vectorFechas;
+    }
+
+    else if (eleccionOrd == 2){
+        {
+            TraceScope traceOrdena("ordenaMerge");
+            PerfScope perfOrdena("ordenaMerge (merge)");
+            ordenar.ordenaMerge(vectorFechas, 0, (int)vectorFechas.size() - 1, estadisticas);
+        }
+
+        if constexpr (Stats::activo){
+            std::cout << "* Informacion Relativa al ordenamiento *" << std::endl;
+            std::cout << "<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<" << std::endl;
+            std::cout << "El numero de comparaciones en el ordenamiento Merge Sort fue de: ";
+            std::cout << estadisticas.obtenerComparaciones() << std::endl;
+            std::cout << "Merge sort no tiene intercambios, por lo tanto, el numero de intercambios en el ordenamiento fue de: ";
+            std::cout << estadisticas.obtenerIntercambios() << std::endl;
+            std::cout << "<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<\n" << std::endl;
+        }
+
+        return vectorFechas;
+    }
+
+    else{
+        throw std::invalid_argument("Tipo de ordenamiento no existente.");
+    }
+
+}
+
 #endif // _AdministradorRegistros_H_
 
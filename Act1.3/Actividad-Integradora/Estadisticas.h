@@ -0,0 +1,42 @@
+#ifndef _ESTADISTICAS_H_
+#define _ESTADISTICAS_H_
+
+#include <cstdint>
+
+/*
+ * Políticas de conteo utilizadas por los algoritmos de ordenamiento y búsqueda
+ * de la clase Registro. La política se elige en tiempo de compilación como
+ * parámetro de plantilla, de modo que NoStats no genera ninguna instrucción
+ * dentro de los ciclos internos y CountingStats lleva la cuenta de comparaciones
+ * e intercambios en enteros de 64 bits para el análisis de los algoritmos.
+ * sumar() acumula los conteos de otra instancia, de modo que cada tarea paralela
+ * cuente por separado y los conteos se combinen al final sin sincronización.
+ *
+ * Complejidad temporal de cada método: O(1)
+ */
+
+struct NoStats{
+    static constexpr bool activo = false;
+
+    void reiniciar() {}
+    void contarComparacion() {}
+    void contarIntercambio() {}
+    void sumar(const NoStats &) {}
+    std::uint64_t obtenerComparaciones() const { return 0; }
+    std::uint64_t obtenerIntercambios() const { return 0; }
+};
+
+struct CountingStats{
+    static constexpr bool activo = true;
+    std::uint64_t comparaciones = 0;
+    std::uint64_t intercambios = 0;
+
+    void reiniciar() { comparaciones = 0; intercambios = 0; }
+    void contarComparacion() { comparaciones++; }
+    void contarIntercambio() { intercambios++; }
+    void sumar(const CountingStats &otras) { comparaciones += otras.comparaciones; intercambios += otras.intercambios; }
+    std::uint64_t obtenerComparaciones() const { return comparaciones; }
+    std::uint64_t obtenerIntercambios() const { return intercambios; }
+};
+
+#endif // _ESTADISTICAS_H_
@@ -0,0 +1,285 @@
+#ifndef _MEMORY_TRACKER_H_
+#define _MEMORY_TRACKER_H_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <new>
+
+// Subsistemas a los que se atribuye la memoria dinámica del programa.
+enum class MemoryTag{
+    Records,
+    ListNodes,
+    Adjacency,
+    HashTable,
+    Heap,
+    Count
+};
+
+class MemoryTracker{
+private:
+    std::atomic<std::int64_t> currentBytes[(int)MemoryTag::Count];
+    std::atomic<std::int64_t> peakBytes[(int)MemoryTag::Count];
+    std::atomic<std::int64_t> totalCurrent;
+    std::atomic<std::int64_t> totalPeak;
+    std::atomic<std::int64_t> numRecords;
+
+    /*
+     * Descripción:
+     *      Constructor privado del contador de memoria. Inicializa los contadores en
+     *      cero y, si existe la variable de entorno BITACORA_MEM, registra la impresión
+     *      del reporte al terminar el programa.
+     *
+     * Parámetros de entrada:
+     *      No posee parámetros de entrada.
+     *
+     * Valor de retorno:
+     *      No retorna ningún valor.
+     *
+     * Complejidad temporal:
+     *      O(1)
+     */
+
+    MemoryTracker();
+
+    /*
+     * Descripción: updatePeak()
+     *      Actualiza un contador de pico si el valor actual lo supera.
+     *
+     * Parámetros de entrada:
+     *      @peak: contador de pico a actualizar.
+     *
+     *      @value: valor actual de memoria.
+     *
+     * Valor de retorno:
+     *      No retorna ningún valor.
+     *
+     * Complejidad temporal:
+     *      O(1) amortizado.
+     */
+
+    static void updatePeak(std::atomic<std::int64_t> &peak, std::int64_t value);
+
+    static void reportAtExit();
+
+public:
+
+    /*
+     * Descripción: getInstance()
+     *      Devuelve la única instancia del contador. La instancia nunca se destruye para
+     *      que las liberaciones que ocurren durante la salida del programa sigan siendo
+     *      válidas.
+     *
+     * Parámetros de entrada:
+     *      No posee parámetros de entrada.
+     *
+     * Valor de retorno:
+     *      Referencia a la instancia del contador.
+     *
+     * Complejidad temporal:
+     *      O(1)
+     */
+
+    static MemoryTracker &getInstance();
+
+    /*
+     * Descripción: allocated() / released()
+     *      Registran una reserva o una liberación de memoria del subsistema indicado.
+     *
+     * Parámetros de entrada:
+     *      @tag: subsistema al que pertenece la memoria.
+     *
+     *      @bytes: número de bytes reservados o liberados.
+     *
+     * Valor de retorno:
+     *      No retorna ningún valor.
+     *
+     * Complejidad temporal:
+     *      O(1)
+     */
+
+    void allocated(MemoryTag tag, std::size_t bytes);
+    void released(MemoryTag tag, std::size_t bytes);
+
+    /*
+     * Descripción: setNumRecords()
+     *      Establece el número de registros (líneas de la bitácora) que se usa para
+     *      calcular los bytes por registro.
+     *
+     * Parámetros de entrada:
+     *      @records: número de líneas de la bitácora cargadas.
+     *
+     * Valor de retorno:
+     *      No retorna ningún valor.
+     *
+     * Complejidad temporal:
+     *      O(1)
+     */
+
+    void setNumRecords(std::int64_t records);
+
+    /*
+     * Descripción: getCurrentBytes() / getPeakBytes()
+     *      Devuelven la memoria actual y el pico de memoria de un subsistema.
+     *
+     * Parámetros de entrada:
+     *      @tag: subsistema a consultar.
+     *
+     * Valor de retorno:
+     *      Número de bytes.
+     *
+     * Complejidad temporal:
+     *      O(1)
+     */
+
+    std::int64_t getCurrentBytes(MemoryTag tag);
+    std::int64_t getPeakBytes(MemoryTag tag);
+
+    /*
+     * Descripción: report()
+     *      Imprime la memoria actual y el pico por subsistema, el total y los bytes pico
+     *      por registro de la bitácora.
+     *
+     * Parámetros de entrada:
+     *      @os: flujo de salida donde se imprime el reporte.
+     *
+     * Valor de retorno:
+     *      No retorna ningún valor.
+     *
+     * Complejidad temporal:
+     *      O(1)
+     */
+
+    void report(std::ostream &os);
+};
+
+/*
+ * Descripción:
+ *      Asignador compatible con los contenedores estándar que reporta cada reserva y
+ *      liberación al MemoryTracker bajo el subsistema Tag.
+ *
+ * Complejidad temporal:
+ *      O(1) adicional por reserva.
+ */
+
+template <class T, MemoryTag Tag>
+class TrackingAllocator{
+public:
+    typedef T value_type;
+
+    template <class U>
+    struct rebind{
+        typedef TrackingAllocator<U, Tag> other;
+    };
+
+    TrackingAllocator() noexcept {}
+
+    template <class U>
+    TrackingAllocator(const TrackingAllocator<U, Tag> &) noexcept {}
+
+    T *allocate(std::size_t n){
+        T *p = static_cast<T *>(::operator new(n * sizeof(T)));
+        MemoryTracker::getInstance().allocated(Tag, n * sizeof(T));
+        return p;
+    }
+
+    void deallocate(T *p, std::size_t n) noexcept{
+        MemoryTracker::getInstance().released(Tag, n * sizeof(T));
+        ::operator delete(p);
+    }
+
+    template <class U>
+    bool operator==(const TrackingAllocator<U, Tag> &) const noexcept{
+        return true;
+    }
+
+    template <class U>
+    bool operator!=(const TrackingAllocator<U, Tag> &) const noexcept{
+        return false;
+    }
+};
+
+inline MemoryTracker::MemoryTracker(){
+
+    for (int i = 0; i < (int)MemoryTag::Count; i++){
+        currentBytes[i] = 0;
+        peakBytes[i] = 0;
+    }
+
+    totalCurrent = 0;
+    totalPeak = 0;
+    numRecords = 0;
+    const char *value = std::getenv("BITACORA_MEM");
+
+    if (value != nullptr && value[0] != '\0' && std::strcmp(value, "0") != 0){
+        std::atexit(reportAtExit);
+    }
+}
+
+inline MemoryTracker &MemoryTracker::getInstance(){
+    static MemoryTracker *instance = new MemoryTracker();
+    return *instance;
+}
+
+inline void MemoryTracker::reportAtExit(){
+    getInstance().report(std::cout);
+}
+
+inline void MemoryTracker::updatePeak(std::atomic<std::int64_t> &peak, std::int64_t value){
+    std::int64_t previous = peak.load(std::memory_order_relaxed);
+
+    while (value > previous && !peak.compare_exchange_weak(previous, value, std::memory_order_relaxed)){
+    }
+}
+
+inline void MemoryTracker::allocated(MemoryTag tag, std::size_t bytes){
+    std::int64_t current = currentBytes[(int)tag].fetch_add((std::int64_t)bytes, std::memory_order_relaxed) + (std::int64_t)bytes;
+    updatePeak(peakBytes[(int)tag], current);
+    std::int64_t total = totalCurrent.fetch_add((std::int64_t)bytes, std::memory_order_relaxed) + (std::int64_t)bytes;
+    updatePeak(totalPeak, total);
+}
+
+inline void MemoryTracker::released(MemoryTag tag, std::size_t bytes){
+    currentBytes[(int)tag].fetch_sub((std::int64_t)bytes, std::memory_order_relaxed);
+    totalCurrent.fetch_sub((std::int64_t)bytes, std::memory_order_relaxed);
+}
+
+inline void MemoryTracker::setNumRecords(std::int64_t records){
+    numRecords = records;
+}
+
+inline std::int64_t MemoryTracker::getCurrentBytes(MemoryTag tag){
+    return currentBytes[(int)tag];
+}
+
+inline std::int64_t MemoryTracker::getPeakBytes(MemoryTag tag){
+    return peakBytes[(int)tag];
+}
+
+inline void MemoryTracker::report(std::ostream &os){
+    const char *names[(int)MemoryTag::Count] = {"registros", "nodos de lista", "adyacencia", "tabla hash", "heap"};
+
+    os << "-+----------------------------------------------------------+-" << std::endl;
+    os << "|          Memoria dinamica por subsistema (bytes)           |" << std::endl;
+    os << "-+----------------------------------------------------------+-" << std::endl;
+    os << std::left << std::setw(18) << "subsistema" << std::right << std::setw(16) << "actual" << std::setw(16) << "pico" << std::endl;
+
+    for (int i = 0; i < (int)MemoryTag::Count; i++){
+        os << std::left << std::setw(18) << names[i] << std::right << std::setw(16) << currentBytes[i].load() << std::setw(16) << peakBytes[i].load() << std::endl;
+    }
+
+    os << std::left << std::setw(18) << "total" << std::right << std::setw(16) << totalCurrent.load() << std::setw(16) << totalPeak.load() << std::endl;
+
+    if (numRecords > 0){
+        os << "Registros: " << numRecords.load() << "    Bytes pico por registro: " << std::fixed << std::setprecision(1)
+           << (double)totalPeak.load() / (double)numRecords.load() << std::defaultfloat << std::endl;
+    }
+
+    os << "-+----------------------------------------------------------+-" << std::endl;
+}
+
+#endif // _MEMORY_TRACKER_H_
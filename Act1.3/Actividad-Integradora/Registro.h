@@ -7,11 +7,19 @@
 #include <fstream>
 #include <iostream>
 #include <stdexcept>
+#include <utility>
+#include "Estadisticas.h"
+#include "Tracer.h"
+#include "MemoryTracker.h"
+#include "ThreadPool.h"
+
+// Cadena cuyas reservas de memoria se atribuyen a los registros de la bitácora.
+typedef std::basic_string<char, std::char_traits<char>, TrackingAllocator<char, MemoryTag::Records>> CadenaRegistro;
 
 class Registro{
     private:
-        std::string mes, dia, horas, minutos, segundos, direccionIp, puerto, error;
-        std::vector<std::string> meses{"Jan", "Feb", "Mar", "Apr", "May", "Jun", "Jul", "Aug", "Sep", "Oct", "Nov", "Dec"};
+        CadenaRegistro mes, dia, horas, minutos, segundos, direccionIp, puerto, error;
+        std::vector<CadenaRegistro, TrackingAllocator<CadenaRegistro, MemoryTag::Records>> meses{"Jan", "Feb", "Mar", "Apr", "May", "Jun", "Jul", "Aug", "Sep", "Oct", "Nov", "Dec"};
         struct tm estructuraFecha; 
         time_t tiempoTranscurrido; 
     
@@ -20,10 +28,14 @@ class Registro{
         Registro(std::string pMes, std::string pDia, std::string pHoras, std::string pMinutos, std::string pSegundos, std::string pDireccionIp, std::string pPuerto, std::string pError);
         void imprimirDatos(const std::vector<Registro> &vectorRegistros);
         time_t obtenerTiempo();
-        void ordenaBurbuja(std::vector<Registro> &vectorRegistros, unsigned int &comparacion, unsigned int &intercambio);
-        void ordenaMerge(std::vector<Registro> &vectorRegistros, int inicioVector, int finalVector, unsigned int &comparacion, unsigned int &intercambio);
-        void merge(std::vector<Registro> &vectorRegistros, int inicioVector, int puntoMedio, int finalVector, unsigned int &comparacion, unsigned int &intercambio);
-        int busquedaBinaria(std::vector<Registro> &vectorRegistrosOrd, Registro fechaBuscada, unsigned int &comparacion);
+        template <class Stats>
+        void ordenaBurbuja(std::vector<Registro> &vectorRegistros, Stats &estadisticas);
+        template <class Stats>
+        void ordenaMerge(std::vector<Registro> &vectorRegistros, int inicioVector, int finalVector, Stats &estadisticas);
+        template <class Stats>
+        void merge(std::vector<Registro> &vectorRegistros, int inicioVector, int puntoMedio, int finalVector, Stats &estadisticas);
+        template <class Stats>
+        int busquedaBinaria(std::vector<Registro> &vectorRegistrosOrd, Registro fechaBuscada, Stats &estadisticas);
         std::vector<Registro> buscarFechas(std::vector<Registro> &vectorRegistrosOrd, Registro fechaInicio, Registro fechaFin);
         void guardarBitacoraOrd(std::vector<Registro> vectorOrdenado, std::string nombreArch);
         bool operator==(const Registro &other) const;
@@ -34,4 +46,221 @@ class Registro{
         bool operator<=(const Registro &other) const;
 };
 
+
+/* Ordena ascendentemente un vector de objetos de la clase Registro mediante 
+ * el algoritmo de ordenamiento de burbuja.
+ *
+ * @vectorRegistros [parámetro por referencia] vector de objetos de la clase 
+ * Registro el cual se desea ordenar de manera ascendente.
+ *
+ * @estadisticas, [parámetro por referencia] política de conteo (NoStats o
+ * CountingStats) que registra el número de comparaciones e intercambios que
+ * realice el algoritmo. Con NoStats el conteo no tiene ningún costo.
+ *
+ * No es necesario que el método devuelva el vector ordenado puesto que este
+ * se pasó por referencia.
+ *
+ * Complejidad temporal: Mejor --> O(n). Promedio --> O(n^2). Peor -->O(n^2)
+ */
+
+template <class Stats>
+void Registro::ordenaBurbuja(std::vector<Registro> &vectorRegistros, Stats &estadisticas){
+    estadisticas.reiniciar();
+
+    int n = (int)vectorRegistros.size();
+
+    for (int i = 0; i < n - 1; i++){
+
+        for (int j = 0; j < n - i - 1; j++){
+            estadisticas.contarComparacion();
+
+            if (vectorRegistros[j] > vectorRegistros[j + 1]){
+                std::swap(vectorRegistros[j], vectorRegistros[j + 1]);
+                estadisticas.contarIntercambio();
+            }
+        }
+    }
+}
+
+/*
+ * Método que ordena de forma ascendente un vector de objetos de la clase Registro 
+ * a través del algoritmo de de ordenamiento Merge recursivo.
+ *
+ * @inicioVector, variable de tipo entero la cual representa el índice más bajo del
+ * vector que define el rango de elementos a ordenar en cada llamada recursiva.
+ *
+ * @finalVector, variable de tipo entero la cual representa el índice más alto del
+ * vector que define el rango de elementos a ordenar en cada llamada recursiva.
+ *
+ * @vectorRegistros [parámetro por referencia] vector de objetos de la clase Registro
+ * el cual se desea ordenar de manera ascendente.
+ *
+ * @estadisticas, [parámetro por referencia] política de conteo (NoStats o
+ * CountingStats) que registra el número de comparaciones e intercambios que
+ * realice el algoritmo. Con NoStats el conteo no tiene ningún costo.
+ *
+ * No es necesario que el método devuelva el vector ordenado puesto que este
+ * se pasó por referencia.
+ *
+ * Complejidad temporal: Mejor --> O(n log n). Promedio --> O(n log n). Peor -->O(n log n)
+ */
+
+template <class Stats>
+void Registro::ordenaMerge(std::vector<Registro> &vectorRegistros, int inicioVector, int finalVector, Stats &estadisticas){
+
+    if (inicioVector < finalVector){
+        int puntoMedio = inicioVector + (finalVector - inicioVector) / 2;
+        bool grande = finalVector - inicioVector + 1 >= 4096;
+
+        // Sólo las pasadas grandes aparecen en la traza; el nombre se construye únicamente
+        // con BITACORA_TRAZA.
+        TraceScope tracePasada([&](){
+            return grande ? "ordenaMerge [" + std::to_string(inicioVector) + ", " + std::to_string(finalVector) + "]" : std::string();
+        });
+
+        // Las dos mitades grandes se ordenan en paralelo en el pool compartido. La mitad
+        // izquierda cuenta en su propia instancia de Stats y se suma al terminar, así
+        // CountingStats da los mismos conteos que la versión secuencial.
+        if (grande && ThreadPool::getInstance().getNumThreads() > 1){
+            Stats estadisticasIzquierda;
+            TaskGroup tareas;
+            tareas.run([&](){
+                ordenaMerge(vectorRegistros, inicioVector, puntoMedio, estadisticasIzquierda);
+            });
+            ordenaMerge(vectorRegistros, puntoMedio + 1, finalVector, estadisticas);
+            tareas.wait();
+            estadisticas.sumar(estadisticasIzquierda);
+        }
+
+        else{
+            ordenaMerge(vectorRegistros, inicioVector, puntoMedio, estadisticas);
+            ordenaMerge(vectorRegistros, puntoMedio + 1, finalVector, estadisticas);
+        }
+
+        merge(vectorRegistros, inicioVector, puntoMedio, finalVector, estadisticas);
+    }
+}
+
+/*
+ * Método auxiliar a ordenaMerge. Su función es combinar dos subvectores
+ * ordenados en uno solo, asegurando que los elementos estén en orden ascendente.
+ *
+ * @inicioVector, variable de tipo entero la cual representa el índice más bajo
+ * de un subvector a combinar.
+ *
+ * @puntoMedio, variable de tipo entero que representa el índice medio que divide
+ * el subvector a combinar en dos partes.
+ *
+ * @finalVector, variable de tipo entero la cual representa el índice más alto del
+ * subvector a combinar.
+ *
+ * @vectorRegistros [parámetro por referencia] vector de objetos de la clase Registro 
+ * el cual se desea ordenar de manera ascendente.
+ *
+ * @estadisticas, [parámetro por referencia] política de conteo (NoStats o
+ * CountingStats) que registra el número de comparaciones e intercambios que
+ * realice el algoritmo. Con NoStats el conteo no tiene ningún costo.
+ *
+ * No devuelve ningún valor de salida directamente. En cambio, su objetivo es
+ * combinar dos subvectores ordenados en uno solo, modificando el arreglo original.
+ * 
+ * Su complejidad forma parte de ordenaMerge.
+ */
+
+template <class Stats>
+void Registro::merge(std::vector<Registro> &vectorRegistros, int inicioVector, int puntoMedio, int finalVector, Stats &estadisticas){
+    int i, j, k;
+    int dimensionSubarreglo1 = puntoMedio - inicioVector + 1;
+    int dimensionSubarreglo2 = finalVector - puntoMedio;
+    std::vector<Registro> vectorIzquierda(dimensionSubarreglo1);
+    std::vector<Registro> vectorDerecha(dimensionSubarreglo2);
+
+    for (i = 0; i < dimensionSubarreglo1; i++){
+        vectorIzquierda[i] = vectorRegistros[inicioVector + i];
+    }
+
+    for (j = 0; j < dimensionSubarreglo2; j++){
+        vectorDerecha[j] = vectorRegistros[puntoMedio + 1 + j];
+    }
+
+    i = 0;
+    j = 0;
+    k = inicioVector;
+
+    while (i < dimensionSubarreglo1 && j < dimensionSubarreglo2){
+        estadisticas.contarComparacion();
+
+        if (vectorIzquierda[i] <= vectorDerecha[j]){
+            vectorRegistros[k] = vectorIzquierda[i];
+            i++;
+        }
+
+        else{
+            vectorRegistros[k] = vectorDerecha[j];
+            j++;
+        }
+
+        k++;
+    }
+
+    while (i < dimensionSubarreglo1){
+        vectorRegistros[k] = vectorIzquierda[i];
+        i++;
+        k++;
+    }
+
+    while (j < dimensionSubarreglo2){
+        vectorRegistros[k] = vectorDerecha[j];
+        j++;
+        k++;
+    }
+}
+
+/*
+ * Busca un determinado elemento de un vector ordenado de objetos de la clase 
+ * Registro mediante un algoritmo de busqueda binaria.
+ *
+ * @vectorRegistrosOrd, [parámetro por referencia] vector de objetos de la clase 
+ * Registro el cual ha sido previamente ordenado de manera ascendente.
+ *
+ * @fechaBuscada, objeto de la clase Registro en la cual se almacena la fecha
+ * que se desea buscar dentro del vector de objetos ordenado.
+ *
+ * @estadisticas, [parámetro por referencia] política de conteo (NoStats o
+ * CountingStats) en la cual se registra el número de comparaciones que el
+ * algoritmo realiza para llegar a la posición del elemento buscado.
+ *
+ * Si no se encuentra el elemento buscado dentro del vector ordenado se retorna un -1.
+ * Si se logra encontrar el elemento buscado, el método retorna la posición en la cual
+ * este fue encontrado.
+ *
+ * Complejidad temporal: Mejor --> O(1). Promedio --> O(log₂ n). Peor --> O(log n)
+ */
+
+template <class Stats>
+int Registro::busquedaBinaria(std::vector<Registro> &vectorRegistrosOrd, Registro fechaBuscada, Stats &estadisticas){
+    int limInferior = 0;
+    int limSuperior = (int)vectorRegistrosOrd.size() - 1;
+    int limIntermedio = 0;
+    estadisticas.reiniciar();
+
+    while (limInferior <= limSuperior){
+        limIntermedio = (limInferior + limSuperior) / 2;
+        estadisticas.contarComparacion();
+
+        if (fechaBuscada == vectorRegistrosOrd[limIntermedio]){
+            return limIntermedio;
+        }
+
+        else if (fechaBuscada < vectorRegistrosOrd[limIntermedio]){
+            limSuperior = limIntermedio - 1;
+        }
+
+        else{
+            limInferior = limIntermedio + 1;
+        }
+    }
+    return -1;
+}
+
 #endif //_REGISTRO_H_
\ No newline at end of file
@@ -0,0 +1,332 @@
+#ifndef _TRACER_H_
+#define _TRACER_H_
+
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+class Tracer{
+private:
+    struct Event{
+        std::string name;
+        char phase;
+        long long timestamp;
+        int threadId;
+    };
+
+    std::vector<Event> events;
+    std::map<std::thread::id, int> threadIds;
+    std::mutex eventsMutex;
+    std::chrono::steady_clock::time_point origin;
+    std::string outputFile;
+    bool enabled;
+
+    /*
+     * Descripción:
+     *      Constructor privado del trazador. Revisa la variable de entorno
+     *      BITACORA_TRAZA y, si existe, habilita el registro de eventos y guarda
+     *      el nombre del archivo donde se escribirá la línea de tiempo.
+     *
+     * Parámetros de entrada:
+     *      No posee parámetros de entrada.
+     *
+     * Valor de retorno:
+     *      No retorna ningún valor.
+     *
+     * Complejidad temporal:
+     *      O(1)
+     */
+
+    Tracer();
+
+    /*
+     * Descripción: record()
+     *      Agrega un evento a la lista de eventos con la marca de tiempo actual en
+     *      microsegundos y el identificador del hilo que lo genera.
+     *
+     * Parámetros de entrada:
+     *      @name: nombre de la etapa del proceso.
+     *
+     *      @phase: 'B' para el inicio de la etapa o 'E' para su final.
+     *
+     * Valor de retorno:
+     *      No retorna ningún valor.
+     *
+     * Complejidad temporal:
+     *      O(log h) amortizado, donde h es el número de hilos registrados.
+     */
+
+    void record(const std::string &name, char phase);
+
+public:
+
+    /*
+     * Descripción:
+     *      Destructor del trazador. Si el trazador está habilitado escribe los
+     *      eventos registrados en el archivo indicado al terminar el programa.
+     *
+     * Parámetros de entrada:
+     *      No posee parámetros de entrada.
+     *
+     * Valor de retorno:
+     *      No retorna ningún valor.
+     *
+     * Complejidad temporal:
+     *      O(e), donde e es el número de eventos registrados.
+     */
+
+    ~Tracer();
+
+    /*
+     * Descripción: getInstance()
+     *      Devuelve la única instancia del trazador compartida por todo el programa.
+     *
+     * Parámetros de entrada:
+     *      No posee parámetros de entrada.
+     *
+     * Valor de retorno:
+     *      Referencia a la instancia del trazador.
+     *
+     * Complejidad temporal:
+     *      O(1)
+     */
+
+    static Tracer &getInstance();
+
+    /*
+     * Descripción: enable()
+     *      Habilita el trazador desde el código, sin depender de la variable de
+     *      entorno BITACORA_TRAZA.
+     *
+     * Parámetros de entrada:
+     *      @fileName: nombre del archivo JSON donde se escribirá la línea de tiempo.
+     *
+     * Valor de retorno:
+     *      No retorna ningún valor.
+     *
+     * Complejidad temporal:
+     *      O(1)
+     */
+
+    void enable(std::string fileName);
+
+    /*
+     * Descripción: isEnabled()
+     *      Indica si el trazador está registrando eventos.
+     *
+     * Parámetros de entrada:
+     *      No posee parámetros de entrada.
+     *
+     * Valor de retorno:
+     *      true si el trazador está habilitado, false en caso contrario.
+     *
+     * Complejidad temporal:
+     *      O(1)
+     */
+
+    bool isEnabled();
+
+    /*
+     * Descripción: begin() / end()
+     *      Registran el inicio y el final de una etapa del proceso en el hilo
+     *      que los invoca. Si el trazador está deshabilitado no hacen nada.
+     *
+     * Parámetros de entrada:
+     *      @name: nombre de la etapa del proceso.
+     *
+     * Valor de retorno:
+     *      No retorna ningún valor.
+     *
+     * Complejidad temporal:
+     *      O(1) amortizado.
+     */
+
+    void begin(const std::string &name);
+    void end(const std::string &name);
+
+    /*
+     * Descripción: write()
+     *      Escribe los eventos registrados en formato JSON "trace_event" de Chrome,
+     *      que puede abrirse con chrome://tracing o con Perfetto.
+     *
+     * Parámetros de entrada:
+     *      No posee parámetros de entrada.
+     *
+     * Valor de retorno:
+     *      No retorna ningún valor.
+     *
+     * Complejidad temporal:
+     *      O(e), donde e es el número de eventos registrados.
+     */
+
+    void write();
+};
+
+/*
+ * Descripción:
+ *      Objeto auxiliar que registra el inicio de una etapa al construirse y su
+ *      final al destruirse, de modo que la etapa queda cerrada aun si se lanza
+ *      una excepción dentro de ella.
+ *
+ *      El nombre también puede ser una función que lo construye; la función sólo se invoca
+ *      si la traza está activa, para no concatenar cadenas en cada llamada cuando no existe
+ *      BITACORA_TRAZA. Un nombre vacío no registra nada.
+ *
+ *      Este archivo es el mismo en Act1.3, Act2.3 y Act5.2: un cambio en una copia se
+ *      aplica a las tres.
+ *
+ * Complejidad temporal:
+ *      O(1), más la construcción del nombre si la traza está activa.
+ */
+
+class TraceScope{
+private:
+    std::string name;
+    bool active;
+
+public:
+    TraceScope(const char *_name);
+    TraceScope(const std::string &_name);
+
+    template <class NameBuilder, class = decltype(std::string(std::declval<NameBuilder &>()()))>
+    TraceScope(NameBuilder buildName);
+
+    ~TraceScope();
+};
+
+inline Tracer::Tracer(){
+    origin = std::chrono::steady_clock::now();
+    enabled = false;
+    const char *fileName = std::getenv("BITACORA_TRAZA");
+
+    if (fileName != nullptr && fileName[0] != '\0'){
+        enable(fileName);
+    }
+}
+
+inline Tracer::~Tracer(){
+
+    if (enabled){
+        write();
+    }
+}
+
+inline Tracer &Tracer::getInstance(){
+    static Tracer instance;
+    return instance;
+}
+
+inline void Tracer::enable(std::string fileName){
+    outputFile = fileName;
+    enabled = true;
+}
+
+inline bool Tracer::isEnabled(){
+    return enabled;
+}
+
+inline void Tracer::record(const std::string &name, char phase){
+    long long timestamp = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - origin).count();
+    std::lock_guard<std::mutex> lock(eventsMutex);
+    auto it = threadIds.find(std::this_thread::get_id());
+
+    if (it == threadIds.end()){
+        it = threadIds.insert(std::make_pair(std::this_thread::get_id(), (int)threadIds.size() + 1)).first;
+    }
+
+    events.push_back({name, phase, timestamp, it->second});
+}
+
+inline void Tracer::begin(const std::string &name){
+
+    if (enabled){
+        record(name, 'B');
+    }
+}
+
+inline void Tracer::end(const std::string &name){
+
+    if (enabled){
+        record(name, 'E');
+    }
+}
+
+inline void Tracer::write(){
+    std::lock_guard<std::mutex> lock(eventsMutex);
+    std::ofstream file(outputFile);
+
+    if (!file.is_open()){
+        std::cerr << "Error: No fue posible escribir la traza en " << outputFile << std::endl;
+        return;
+    }
+
+    file << "{\"traceEvents\":[\n";
+
+    for (size_t i = 0; i < events.size(); i++){
+        std::string escapedName;
+
+        for (char c : events[i].name){
+
+            if (c == '"' || c == '\\'){
+                escapedName += '\\';
+            }
+
+            escapedName += c;
+        }
+
+        file << "{\"name\":\"" << escapedName << "\",\"cat\":\"bitacora\",\"ph\":\"" << events[i].phase
+             << "\",\"ts\":" << events[i].timestamp << ",\"pid\":1,\"tid\":" << events[i].threadId << "}";
+        file << (i + 1 < events.size() ? ",\n" : "\n");
+    }
+
+    file << "],\"displayTimeUnit\":\"ms\"}\n";
+    file.close();
+}
+
+inline TraceScope::TraceScope(const char *_name){
+    active = Tracer::getInstance().isEnabled() && _name[0] != '\0';
+
+    if (active){
+        name = _name;
+        Tracer::getInstance().begin(name);
+    }
+}
+
+inline TraceScope::TraceScope(const std::string &_name){
+    active = Tracer::getInstance().isEnabled() && !_name.empty();
+
+    if (active){
+        name = _name;
+        Tracer::getInstance().begin(name);
+    }
+}
+
+template <class NameBuilder, class>
+inline TraceScope::TraceScope(NameBuilder buildName){
+    active = Tracer::getInstance().isEnabled();
+
+    if (active){
+        name = buildName();
+        active = !name.empty();
+    }
+
+    if (active){
+        Tracer::getInstance().begin(name);
+    }
+}
+
+inline TraceScope::~TraceScope(){
+
+    if (active){
+        Tracer::getInstance().end(name);
+    }
+}
+
+#endif // _TRACER_H_
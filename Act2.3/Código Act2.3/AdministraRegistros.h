@@ -114,6 +114,10 @@ AdministraRegistros<T>::AdministraRegistros(std::string direccionArch){
 
     std::string mes, dia, horas, minutos, segundos, direccionIp, puerto, error;
     std::ifstream archivo(direccionArch);
+    TraceScope traceLectura("AdministraRegistros: lectura");
+    Tracer &tracer = Tracer::getInstance();
+    const int registrosPorBloque = 4096;
+    int registrosLeidos = 0;
 
     try{
 
@@ -122,6 +126,7 @@ AdministraRegistros<T>::AdministraRegistros(std::string direccionArch){
         }
 
         else{
+            tracer.begin("lectura: bloque 0");
 
             while (std::getline(archivo, mes, ' ') &&
                    std::getline(archivo, dia, ' ') &&
@@ -134,8 +139,16 @@ AdministraRegistros<T>::AdministraRegistros(std::string direccionArch){
             {
                 Registro registroTemp(mes, dia, horas, minutos, segundos, direccionIp, puerto, error);
                 listaRegistros.addLast(registroTemp);
+                registrosLeidos++;
+
+                if (registrosLeidos % registrosPorBloque == 0 && tracer.isEnabled()){
+                    tracer.end("lectura: bloque");
+                    tracer.begin("lectura: bloque " + std::to_string(registrosLeidos / registrosPorBloque));
+                }
             }
 
+            tracer.end("lectura: bloque");
+            MemoryTracker::getInstance().setNumRecords(listaRegistros.getNumElements());
             archivo.close();
         }
     }
@@ -170,6 +183,7 @@ void AdministraRegistros<T>::printList(){
 
 template <class T>
 void AdministraRegistros<T>::getSublist(DLLNode<T> *fechaInicio, DLLNode<T> *fechaFin){
+    TraceScope traceSublista("getSublist");
     listaRegistros.getSublist(subListaRegistros, fechaInicio, fechaFin);
 
 }
@@ -1,6 +1,12 @@
 #ifndef _DLLNODE_H_
 #define _DLLNODE_H_
 
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include "MemoryTracker.h"
+
 template <class T>
 class DLLNode{
 public:
@@ -28,20 +34,57 @@ public:
     *
     * @valor, parámetro de cualquier tipo T utilizado para asignar un
     * valor específico al miembro de datos "data" del nodo de la lista
-    * enlazada doble.
+    * enlazada doble. El valor se mueve al nodo, por lo que el constructor no
+    * lanza excepciones cuando T se puede mover sin lanzarlas.
     *
     * No retorna ningún valor.
     *
     * Complejidad: O(1)
     */
 
-    DLLNode(T value);
+    DLLNode(T value) noexcept(std::is_nothrow_move_constructible<T>::value);
+
+   /*
+    * Reservan y liberan la memoria de cada nodo de la lista enlazada doble
+    * reportándola al MemoryTracker como memoria de nodos de lista. La
+    * versión sin tamaño es la que usa delete y libera sizeof(DLLNode<T>),
+    * el mismo tamaño que recibe operator new().
+    *
+    * @size, número de bytes del nodo.
+    * @p, puntero al nodo que se libera.
+    *
+    * operator new() retorna el puntero a la memoria reservada.
+    *
+    * Complejidad: O(1)
+    */
+    static void *operator new(std::size_t size);
+    static void operator delete(void *p);
+    static void operator delete(void *p, std::size_t size);
 };
 
 template <class T>
 DLLNode<T>::DLLNode() : data{}, next{nullptr}, prev{nullptr} {}
 
 template <class T>
-DLLNode<T>::DLLNode(T value) : data{value}, next{nullptr}, prev{nullptr} {}
+DLLNode<T>::DLLNode(T value) noexcept(std::is_nothrow_move_constructible<T>::value) : data{std::move(value)}, next{nullptr}, prev{nullptr} {}
+
+template <class T>
+void *DLLNode<T>::operator new(std::size_t size){
+    void *p = ::operator new(size);
+    MemoryTracker::getInstance().allocated(MemoryTag::ListNodes, size);
+    return p;
+}
+
+template <class T>
+void DLLNode<T>::operator delete(void *p){
+    MemoryTracker::getInstance().released(MemoryTag::ListNodes, sizeof(DLLNode<T>));
+    ::operator delete(p);
+}
+
+template <class T>
+void DLLNode<T>::operator delete(void *p, std::size_t size){
+    MemoryTracker::getInstance().released(MemoryTag::ListNodes, size);
+    ::operator delete(p);
+}
 
 #endif // _DLLNODE_H
\ No newline at end of file
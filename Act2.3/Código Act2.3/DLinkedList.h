@@ -5,6 +5,9 @@
 #include <stdexcept>
 #include "DLLNode.h"
 #include "Registro.h"
+#include "Tracer.h"
+#include "PerfCounters.h"
+#include "ThreadPool.h"
 
 template <class T>
 class DLinkedList{
@@ -13,7 +16,7 @@ private:
     DLLNode<T> *head;
     DLLNode<T> *tail;
     int numElements;
-    void quicksort(DLLNode<T> *low, DLLNode<T> *high);
+    void quicksort(DLLNode<T> *low, DLLNode<T> *high, int profundidad);
     void swap(T *a, T *b);
     DLLNode<T> *particion(DLLNode<T> *low, DLLNode<T> *high);
     DLLNode<T> *medio(DLLNode<T> *start, DLLNode<T> *last);
@@ -170,7 +173,7 @@ DLinkedList<T>::~DLinkedList(){
 template <class T>
 void DLinkedList<T>::addFirst(T value){
 
-    DLLNode<T> *newNode = new DLLNode<T>(value);
+    DLLNode<T> *newNode = new DLLNode<T>(std::move(value));
 
     if (head == nullptr && tail == nullptr){
         head = newNode;
@@ -190,11 +193,11 @@ template <class T>
 void DLinkedList<T>::addLast(T value){
 
     if (head == nullptr && tail == nullptr){
-        addFirst(value);
+        addFirst(std::move(value));
     }
 
     else{
-        DLLNode<T> *newNode = new DLLNode<T>(value);
+        DLLNode<T> *newNode = new DLLNode<T>(std::move(value));
         tail->next = newNode;
         newNode->prev = tail;
         tail = newNode;
@@ -230,6 +233,7 @@ void DLinkedList<T>::printList(){
 
 template <class T>
 void DLinkedList<T>::saveList(std::string nombreArch){
+    TraceScope traceEscritura([&nombreArch](){ return "saveList " + nombreArch; });
     std::ofstream archivo(nombreArch);
 
     try{
@@ -259,6 +263,8 @@ void DLinkedList<T>::saveList(std::string nombreArch){
 
 template <class T>
 DLLNode<T>* DLinkedList<T>::binarySearch(T fechaBuscada){
+    TraceScope traceBusqueda("binarySearch");
+    PerfScope perfBusqueda("binarySearch (medio)");
     DLLNode<T> *start = head;
     DLLNode<T> *last = nullptr;
 
@@ -316,19 +322,39 @@ void DLinkedList<T>::swap(T *a, T *b){
     *b = temp;
 }
 
+/*
+ * Las dos particiones que deja el pivote ocupan nodos distintos y particion()
+ * solo intercambia datos, nunca enlaces, así que en los primeros niveles de la
+ * recursión ambas mitades se ordenan en paralelo en el pool compartido.
+ */
 template <class T>
-void DLinkedList<T>::quicksort(DLLNode<T> *low, DLLNode<T> *high){
+void DLinkedList<T>::quicksort(DLLNode<T> *low, DLLNode<T> *high, int profundidad){
 
     if (high != nullptr && low != high && low != high->next){
         DLLNode<T> *pivot = particion(low, high);
-        quicksort(low, pivot->prev);
-        quicksort(pivot->next, high);
+        ThreadPool &pool = ThreadPool::getInstance();
+
+        if (pool.getNumThreads() > 1 && (1 << profundidad) < 4 * pool.getNumThreads()){
+            TaskGroup tareas(pool);
+            tareas.run([this, low, pivot, profundidad](){
+                quicksort(low, pivot->prev, profundidad + 1);
+            });
+            quicksort(pivot->next, high, profundidad + 1);
+            tareas.wait();
+        }
+
+        else{
+            quicksort(low, pivot->prev, profundidad + 1);
+            quicksort(pivot->next, high, profundidad + 1);
+        }
     }
 }
 
 template <class T>
 void DLinkedList<T>::sort(){
-    quicksort(head, tail);
+    TraceScope traceOrdena("quicksort");
+    PerfScope perfOrdena("quicksort (particion)");
+    quicksort(head, tail, 0);
 }
 
 template <class T>
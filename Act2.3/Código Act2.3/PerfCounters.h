@@ -0,0 +1,496 @@
+#ifndef _PERF_COUNTERS_H_
+#define _PERF_COUNTERS_H_
+
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+// Contadores de hardware que se muestrean en cada fase: ciclos, instrucciones,
+// fallos de lectura en L1 de datos, fallos en el último nivel de caché (LLC)
+// y predicciones de salto fallidas. Se abren como un solo grupo para que el kernel
+// los programe juntos; si el grupo se multiplexa, los valores se escalan por la
+// fracción del tiempo en que estuvo activo y la muestra se marca como escalada.
+const int NUM_PERF_COUNTERS = 5;
+
+struct PerfSample{
+    std::uint64_t values[NUM_PERF_COUNTERS] = {0, 0, 0, 0, 0};
+    bool available[NUM_PERF_COUNTERS] = {false, false, false, false, false};
+    bool scaled = false;
+    std::uint64_t calls = 0;
+};
+
+class PerfCounters{
+private:
+    std::map<std::string, PerfSample> phases;
+    std::vector<std::string> phaseOrder;
+    std::mutex phasesMutex;
+    bool enabled;
+
+    /*
+     * Descripción:
+     *      Constructor privado del colector. Revisa la variable de entorno BITACORA_PERF
+     *      y, si existe, habilita el muestreo de contadores por fase.
+     *
+     * Parámetros de entrada:
+     *      No posee parámetros de entrada.
+     *
+     * Valor de retorno:
+     *      No retorna ningún valor.
+     *
+     * Complejidad temporal:
+     *      O(1)
+     */
+
+    PerfCounters();
+
+public:
+
+    /*
+     * Descripción:
+     *      Destructor del colector. Si está habilitado imprime el reporte de contadores
+     *      por fase al terminar el programa.
+     *
+     * Parámetros de entrada:
+     *      No posee parámetros de entrada.
+     *
+     * Valor de retorno:
+     *      No retorna ningún valor.
+     *
+     * Complejidad temporal:
+     *      O(f), donde f es el número de fases registradas.
+     */
+
+    ~PerfCounters();
+
+    /*
+     * Descripción: getInstance()
+     *      Devuelve la única instancia del colector compartida por todo el programa.
+     *
+     * Parámetros de entrada:
+     *      No posee parámetros de entrada.
+     *
+     * Valor de retorno:
+     *      Referencia a la instancia del colector.
+     *
+     * Complejidad temporal:
+     *      O(1)
+     */
+
+    static PerfCounters &getInstance();
+
+    /*
+     * Descripción: enable() / isEnabled()
+     *      Habilitan el colector desde el código e indican si está muestreando.
+     *
+     * Parámetros de entrada:
+     *      No posee parámetros de entrada.
+     *
+     * Valor de retorno:
+     *      isEnabled() devuelve true si el colector está habilitado.
+     *
+     * Complejidad temporal:
+     *      O(1)
+     */
+
+    void enable();
+    bool isEnabled();
+
+    /*
+     * Descripción: attachThread()
+     *      Abre los contadores del hilo que lo invoca y lo registra para que sus valores
+     *      se sumen a todas las fases. Los hilos del ThreadPool lo llaman al iniciar, de
+     *      modo que el trabajo que una fase reparte en el pool (readGraph, ordenaMerge,
+     *      quicksort, getHashT) se cuenta en esa fase.
+     *
+     * Parámetros de entrada:
+     *      No posee parámetros de entrada.
+     *
+     * Valor de retorno:
+     *      No retorna ningún valor.
+     *
+     * Complejidad temporal:
+     *      O(1)
+     */
+
+    void attachThread();
+
+    /*
+     * Descripción: readCurrent()
+     *      Lee el valor actual de los contadores sumado sobre todos los hilos registrados:
+     *      el que lo invoca y los que llamaron a attachThread(). Los descriptores se abren
+     *      una sola vez por hilo con perf_event_open como un grupo cuyo líder es el primer
+     *      contador que se logra abrir; los que el kernel o el procesador no permiten
+     *      abrir se marcan como no disponibles. Cada grupo se lee de una sola vez junto
+     *      con sus tiempos habilitado y en ejecución, y si estuvo multiplexado sus
+     *      valores se escalan por habilitado / en ejecución.
+     *
+     * Parámetros de entrada:
+     *      @sample: muestra donde se guardan los valores leídos.
+     *
+     * Valor de retorno:
+     *      No retorna ningún valor.
+     *
+     * Complejidad temporal:
+     *      O(h), donde h es el número de hilos registrados.
+     */
+
+    void readCurrent(PerfSample &sample);
+
+    /*
+     * Descripción: accumulate()
+     *      Suma a la fase indicada la diferencia entre dos lecturas de los contadores.
+     *
+     * Parámetros de entrada:
+     *      @phase: nombre de la fase.
+     *
+     *      @start: lectura al inicio de la fase.
+     *
+     *      @finish: lectura al final de la fase.
+     *
+     * Valor de retorno:
+     *      No retorna ningún valor.
+     *
+     * Complejidad temporal:
+     *      O(log f), donde f es el número de fases registradas.
+     */
+
+    void accumulate(const std::string &phase, const PerfSample &start, const PerfSample &finish);
+
+    /*
+     * Descripción: report()
+     *      Imprime, para cada fase, los ciclos, instrucciones, fallos de L1 y LLC, saltos
+     *      mal predichos y las instrucciones por ciclo. Los contadores no disponibles se
+     *      muestran como "n/d" y las fases con valores escalados se señalan.
+     *
+     * Parámetros de entrada:
+     *      @os: flujo de salida donde se imprime el reporte.
+     *
+     * Valor de retorno:
+     *      No retorna ningún valor.
+     *
+     * Complejidad temporal:
+     *      O(f), donde f es el número de fases registradas.
+     */
+
+    void report(std::ostream &os);
+};
+
+/*
+ * Descripción:
+ *      Objeto auxiliar que lee los contadores al construirse y acumula la diferencia
+ *      en la fase indicada al destruirse. Si el colector está deshabilitado no hace
+ *      ninguna llamada al sistema.
+ *
+ * Complejidad temporal:
+ *      O(1)
+ */
+
+class PerfScope{
+private:
+    std::string phase;
+    PerfSample start;
+    bool active;
+
+public:
+    PerfScope(const std::string &_phase);
+    ~PerfScope();
+};
+
+inline PerfCounters::PerfCounters(){
+    const char *value = std::getenv("BITACORA_PERF");
+    enabled = (value != nullptr && value[0] != '\0' && std::strcmp(value, "0") != 0);
+}
+
+inline PerfCounters::~PerfCounters(){
+
+    if (enabled && !phaseOrder.empty()){
+        report(std::cout);
+    }
+}
+
+inline PerfCounters &PerfCounters::getInstance(){
+    static PerfCounters instance;
+    return instance;
+}
+
+inline void PerfCounters::enable(){
+    enabled = true;
+}
+
+inline bool PerfCounters::isEnabled(){
+    return enabled;
+}
+
+#ifdef __linux__
+
+struct PerfEventFds{
+    int fds[NUM_PERF_COUNTERS];
+    int slots[NUM_PERF_COUNTERS];
+    int leader;
+    int numOpen;
+
+    PerfEventFds(){
+        const std::uint32_t types[NUM_PERF_COUNTERS] = {
+            PERF_TYPE_HARDWARE, PERF_TYPE_HARDWARE, PERF_TYPE_HW_CACHE, PERF_TYPE_HARDWARE, PERF_TYPE_HARDWARE};
+        const std::uint64_t configs[NUM_PERF_COUNTERS] = {
+            PERF_COUNT_HW_CPU_CYCLES,
+            PERF_COUNT_HW_INSTRUCTIONS,
+            PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16),
+            PERF_COUNT_HW_CACHE_MISSES,
+            PERF_COUNT_HW_BRANCH_MISSES};
+
+        leader = -1;
+        numOpen = 0;
+
+        for (int i = 0; i < NUM_PERF_COUNTERS; i++){
+            perf_event_attr attr;
+            std::memset(&attr, 0, sizeof(attr));
+            attr.size = sizeof(attr);
+            attr.type = types[i];
+            attr.config = configs[i];
+            attr.exclude_kernel = 1;
+            attr.exclude_hv = 1;
+            attr.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+            fds[i] = (int)syscall(SYS_perf_event_open, &attr, 0, -1, leader, 0);
+            slots[i] = (fds[i] >= 0) ? numOpen++ : -1;
+
+            if (fds[i] >= 0 && leader < 0){
+                leader = fds[i];
+            }
+        }
+
+        std::lock_guard<std::mutex> lock(registryMutex());
+        registry().push_back(this);
+    }
+
+    /*
+     * Descripción: registry() / registryMutex()
+     *      Conjuntos de contadores abiertos por cada hilo. Se reservan con new y nunca se
+     *      destruyen para que los hilos del pool puedan salir del registro aunque el
+     *      colector ya se haya destruido al terminar el programa.
+     */
+
+    static std::vector<PerfEventFds *> &registry(){
+        static std::vector<PerfEventFds *> *threads = new std::vector<PerfEventFds *>();
+        return *threads;
+    }
+
+    static std::mutex &registryMutex(){
+        static std::mutex *threadsMutex = new std::mutex();
+        return *threadsMutex;
+    }
+
+    static PerfEventFds &forThisThread(){
+        static thread_local PerfEventFds events;
+        return events;
+    }
+
+    /*
+     * Descripción: read()
+     *      Lee el grupo de este hilo y suma sus valores, escalados si el grupo estuvo
+     *      multiplexado, a la muestra. Un hilo que aún no se ha ejecutado aporta cero.
+     *
+     * Valor de retorno:
+     *      false si el grupo no se pudo leer.
+     */
+
+    bool read(PerfSample &sample){
+        // Formato de PERF_FORMAT_GROUP: nr, tiempo habilitado, tiempo en ejecución y un valor por miembro.
+        std::uint64_t buffer[3 + NUM_PERF_COUNTERS];
+        ssize_t expected = (ssize_t)((3 + numOpen) * sizeof(std::uint64_t));
+
+        if (leader < 0 || ::read(leader, buffer, sizeof(buffer)) < expected){
+            return false;
+        }
+
+        bool scaled = buffer[2] < buffer[1];
+        sample.scaled = sample.scaled || scaled;
+
+        for (int i = 0; i < NUM_PERF_COUNTERS; i++){
+
+            if (slots[i] < 0){
+                sample.available[i] = false;
+            }
+
+            else if (buffer[2] > 0){
+                std::uint64_t value = buffer[3 + slots[i]];
+                sample.values[i] += scaled ? (std::uint64_t)((double)value * (double)buffer[1] / (double)buffer[2]) : value;
+            }
+        }
+
+        return true;
+    }
+
+
+    ~PerfEventFds(){
+
+        {
+            std::lock_guard<std::mutex> lock(registryMutex());
+            std::vector<PerfEventFds *> &threads = registry();
+
+            for (std::size_t i = 0; i < threads.size(); i++){
+
+                if (threads[i] == this){
+                    threads[i] = threads.back();
+                    threads.pop_back();
+                    break;
+                }
+            }
+        }
+
+        // Los miembros se cierran antes que el líder del grupo.
+        for (int i = NUM_PERF_COUNTERS - 1; i >= 0; i--){
+
+            if (fds[i] >= 0){
+                close(fds[i]);
+            }
+        }
+    }
+};
+
+inline void PerfCounters::attachThread(){
+    PerfEventFds::forThisThread();
+}
+
+inline void PerfCounters::readCurrent(PerfSample &sample){
+    PerfEventFds::forThisThread();
+    bool anyRead = false;
+    sample.scaled = false;
+
+    for (int i = 0; i < NUM_PERF_COUNTERS; i++){
+        sample.available[i] = true;
+        sample.values[i] = 0;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(PerfEventFds::registryMutex());
+
+        for (PerfEventFds *events : PerfEventFds::registry()){
+            anyRead = events->read(sample) || anyRead;
+        }
+    }
+
+    for (int i = 0; i < NUM_PERF_COUNTERS; i++){
+        sample.available[i] = sample.available[i] && anyRead;
+
+        if (!sample.available[i]){
+            sample.values[i] = 0;
+        }
+    }
+}
+
+#else
+
+inline void PerfCounters::attachThread(){
+}
+
+inline void PerfCounters::readCurrent(PerfSample &sample){
+    sample.scaled = false;
+
+    for (int i = 0; i < NUM_PERF_COUNTERS; i++){
+        sample.available[i] = false;
+        sample.values[i] = 0;
+    }
+}
+
+#endif
+
+inline void PerfCounters::accumulate(const std::string &phase, const PerfSample &start, const PerfSample &finish){
+    std::lock_guard<std::mutex> lock(phasesMutex);
+    auto it = phases.find(phase);
+
+    if (it == phases.end()){
+        it = phases.insert(std::make_pair(phase, PerfSample())).first;
+
+        for (int i = 0; i < NUM_PERF_COUNTERS; i++){
+            it->second.available[i] = true;
+        }
+
+        phaseOrder.push_back(phase);
+    }
+
+    for (int i = 0; i < NUM_PERF_COUNTERS; i++){
+        bool available = start.available[i] && finish.available[i];
+        it->second.available[i] = it->second.available[i] && available;
+        // Un hilo que sale durante la fase deja de sumarse; su diferencia se descarta.
+        it->second.values[i] += (available && finish.values[i] >= start.values[i]) ? finish.values[i] - start.values[i] : 0;
+    }
+
+    it->second.scaled = it->second.scaled || start.scaled || finish.scaled;
+    it->second.calls++;
+}
+
+inline void PerfCounters::report(std::ostream &os){
+    std::lock_guard<std::mutex> lock(phasesMutex);
+    const char *names[NUM_PERF_COUNTERS] = {"ciclos", "instrucciones", "fallos L1d", "fallos LLC", "saltos fallidos"};
+    bool anyAvailable = false;
+
+    os << "-+----------------------------------------------------------+-" << std::endl;
+    os << "|      Contadores de hardware por fase (perf_event_open)     |" << std::endl;
+    os << "-+----------------------------------------------------------+-" << std::endl;
+
+    for (const std::string &phase : phaseOrder){
+        const PerfSample &sample = phases[phase];
+        os << phase << " (" << sample.calls << (sample.calls == 1 ? " llamada)" : " llamadas)")
+           << (sample.scaled ? " [escalado por multiplexacion]" : "") << std::endl;
+
+        for (int i = 0; i < NUM_PERF_COUNTERS; i++){
+            os << "    " << std::left << std::setw(18) << names[i] << std::right;
+
+            if (sample.available[i]){
+                os << sample.values[i] << std::endl;
+                anyAvailable = true;
+            }
+
+            else{
+                os << "n/d" << std::endl;
+            }
+        }
+
+        if (sample.available[0] && sample.available[1] && sample.values[0] > 0){
+            os << "    " << std::left << std::setw(18) << "IPC" << std::right << std::fixed << std::setprecision(2)
+               << (double)sample.values[1] / (double)sample.values[0] << std::defaultfloat << std::endl;
+        }
+    }
+
+    if (!anyAvailable){
+        os << "Contadores no disponibles en este sistema (perf_event_paranoid o virtualizacion)." << std::endl;
+    }
+
+    os << "Cada fase suma el hilo que la abre y los hilos del pool." << std::endl;
+
+    os << "-+----------------------------------------------------------+-" << std::endl;
+}
+
+inline PerfScope::PerfScope(const std::string &_phase){
+    active = PerfCounters::getInstance().isEnabled();
+
+    if (active){
+        phase = _phase;
+        PerfCounters::getInstance().readCurrent(start);
+    }
+}
+
+inline PerfScope::~PerfScope(){
+
+    if (active){
+        PerfSample finish;
+        PerfCounters::getInstance().readCurrent(finish);
+        PerfCounters::getInstance().accumulate(phase, start, finish);
+    }
+}
+
+#endif // _PERF_COUNTERS_H_
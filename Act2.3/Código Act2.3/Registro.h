@@ -7,12 +7,17 @@
 #include <ctime>
 #include <vector>
 #include <fstream>
+#include <string>
+#include "MemoryTracker.h"
+
+// Cadena cuyas reservas de memoria se atribuyen a los registros de la bitácora.
+typedef std::basic_string<char, std::char_traits<char>, TrackingAllocator<char, MemoryTag::Records>> CadenaRegistro;
 
 class Registro{
 
     private:
-        std::string mes, dia, horas, minutos, segundos, direccionIp, puerto, error;
-        std::vector<std::string> meses{"Jan", "Feb", "Mar", "Apr", "May", "Jun", "Jul", "Aug", "Sep", "Oct", "Nov", "Dec"};
+        CadenaRegistro mes, dia, horas, minutos, segundos, direccionIp, puerto, error;
+        std::vector<CadenaRegistro, TrackingAllocator<CadenaRegistro, MemoryTag::Records>> meses{"Jan", "Feb", "Mar", "Apr", "May", "Jun", "Jul", "Aug", "Sep", "Oct", "Nov", "Dec"};
         struct tm estructuraFecha;
         time_t tiempoTranscurrido;
 
@@ -115,10 +120,10 @@ Registro::Registro(std::string pMes, std::string pDia, std::string pHoras, std::
     puerto = pPuerto;
     error = pError;
 
-    estructuraFecha.tm_hour = std::stoi(horas);
-    estructuraFecha.tm_min = std::stoi(minutos);
-    estructuraFecha.tm_sec = std::stoi(segundos);
-    estructuraFecha.tm_mday = std::stoi(dia);
+    estructuraFecha.tm_hour = std::stoi(pHoras);
+    estructuraFecha.tm_min = std::stoi(pMinutos);
+    estructuraFecha.tm_sec = std::stoi(pSegundos);
+    estructuraFecha.tm_mday = std::stoi(pDia);
     estructuraFecha.tm_isdst = 0;
 
     for (int i = 0; i < (int)meses.size(); i++){
@@ -136,7 +141,7 @@ time_t Registro::obtenerTiempo(){
 }
 
 std::string Registro::imprimirDatos(){
-    return mes + " " + dia + " " + horas + ":" + minutos + ":" + segundos + " " + direccionIp + ":" + puerto + " " + error;
+    return std::string(mes + " " + dia + " " + horas + ":" + minutos + ":" + segundos + " " + direccionIp + ":" + puerto + " " + error);
 }
 
 bool Registro::operator==(const Registro &other) const{
@@ -29,13 +29,21 @@
  *
  * Banderas de compilación y ejecución:
  *    Compilación para debug:
- *    g++ -std=c++17 -g -o main *.cpp
+ *    g++ -std=c++17 -pthread -g -o main *.cpp
  *    Compilación para ejecución:
- *    g++ -std=c++17 -O3 -o main *.cpp
+ *    g++ -std=c++17 -pthread -O3 -o main *.cpp
  *    Ejecucion con valgrind:
  *    valgrind --leak-check=full ./main
  *    Ejecución:
  *    ./main
+ *    Ejecución con traza de etapas (chrome://tracing o Perfetto):
+ *    BITACORA_TRAZA=traza.json ./main
+ *    Ejecución con contadores de hardware por fase (Linux):
+ *    BITACORA_PERF=1 ./main
+ *    Ejecución con reporte de memoria por subsistema:
+ *    BITACORA_MEM=1 ./main
+ *    Número de hilos para el ordenamiento (por omisión, los núcleos disponibles):
+ *    BITACORA_HILOS=4 ./main
  */
 
 
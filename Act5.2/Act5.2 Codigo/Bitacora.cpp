@@ -2,26 +2,120 @@
 
 Bitacora::Bitacora() {}
 
+template <class Table>
+void Bitacora::analyze(std::string fileName, int option, bool allowSnapshot){
+    Graph<Table> graph;
+
+    // Con BITACORA_AGREGAR las conexiones repetidas se fusionan; el snapshot no guarda las
+    // aristas agregadas, así que en ese modo siempre se construye el grafo.
+    const char *aggregate = std::getenv("BITACORA_AGREGAR");
+    bool aggregatedEdges = aggregate != nullptr && aggregate[0] != '\0' && std::string(aggregate) != "0";
+
+    // Con BITACORA_SNAPSHOT se reutiliza el grafo guardado si corresponde a la bitácora;
+    // si no existe o está desactualizado, se construye y se guarda para la siguiente vez.
+    const char *snapshotFile = std::getenv("BITACORA_SNAPSHOT");
+    bool useSnapshot = allowSnapshot && !aggregatedEdges && snapshotFile != nullptr && snapshotFile[0] != '\0';
+    bool fromSnapshot = useSnapshot && graph.loadSnapshot(snapshotFile, fileName, option);
+
+    if (!fromSnapshot){
+        const char *compress = std::getenv("BITACORA_COMPRIMIR");
+        graph.setCompressedAdjacency(compress != nullptr && compress[0] != '\0' && std::string(compress) != "0");
+        graph.setAggregatedEdges(aggregatedEdges);
+        graph.readGraph(fileName, 1, 1, option);
+
+        // Con BITACORA_IMAGEN_HASH la tabla hash se mapea de una imagen guardada en lugar de
+        // reconstruirse; si no existe o está desactualizada, se construye y se guarda.
+        const char *imageFile = std::getenv("BITACORA_IMAGEN_HASH");
+        bool useImage = allowSnapshot && !aggregatedEdges && imageFile != nullptr && imageFile[0] != '\0';
+
+        if (!useImage || !graph.loadHashImage(imageFile, fileName)){
+            graph.getHashT();
+
+            if (useImage && !graph.saveHashImage(imageFile, fileName)){
+                std::cerr << "Error: No fue posible escribir la imagen de la tabla hash en " << imageFile << std::endl;
+            }
+        }
+
+        if (useSnapshot && !graph.saveSnapshot(snapshotFile, fileName, option)){
+            std::cerr << "Error: No fue posible escribir el snapshot en " << snapshotFile << std::endl;
+        }
+    }
+
+    // BITACORA_HASH_PERFECTO resuelve las consultas con un hash perfecto de las IP cargadas.
+    const char *perfectHash = std::getenv("BITACORA_HASH_PERFECTO");
+
+    if (perfectHash != nullptr && perfectHash[0] != '\0' && std::string(perfectHash) != "0"){
+        graph.buildPerfectHash();
+    }
+
+    // BITACORA_ESTADISTICAS agrega los histogramas de sondeo y la ocupación de la tabla.
+    const char *hashStats = std::getenv("BITACORA_ESTADISTICAS");
+    bool detailedStats = hashStats != nullptr && hashStats[0] != '\0' && std::string(hashStats) != "0";
+    graph.printCollisions(detailedStats);
+
+    // BITACORA_REPORTE_HASH compara las políticas de hash y tamaño con las IP cargadas.
+    const char *hashReport = std::getenv("BITACORA_REPORTE_HASH");
+
+    if (hashReport != nullptr && hashReport[0] != '\0' && std::string(hashReport) != "0"){
+        graph.printHashPolicyReport(detailedStats);
+    }
+
+    std::cout << "\nIngrese la direccion IP en formato string del cual desea obtener su resumen: ";
+    std::cin >> searchedIp;
+    graph.getIPSummary(searchedIp);
+    graph.getIPInSummary(searchedIp);
+}
+
 Bitacora::Bitacora(std::string fileName){
     int option;
 
     try{
-        std::cout << "Ingrese un número del 1 al 5 para determinar el tamaño máximo (MaxSize) de la Tabla Hash. Estos numeros representan los 5 numeros primos mayores mas cercanos al numero de direcciones IP de la bitacora:  ";
+        std::cout << "Ingrese un número del 1 al 5 para determinar el tamaño máximo (MaxSize) de la Tabla Hash. Estos numeros representan los 5 numeros primos mayores mas cercanos al numero de direcciones IP de la bitacora (0 para que la tabla crezca automaticamente):  ";
         std::cin >> option;
 
         std::cout << std::endl;
 
-        if(std::cin.fail() || option > 5 || option < 1 ){
-            throw std::invalid_argument("Valor ingresado invalido. Ingrese un numero entre el 1 al 5.");
+        if(std::cin.fail() || option > 5 || option < 0 ){
+            throw std::invalid_argument("Valor ingresado invalido. Ingrese un numero entre el 0 al 5.");
         }
 
-        graph.readGraph(fileName, 1, 1, option);
-        graph.getHashT();
-        graph.printCollisions();
+        // BITACORA_TABLA elige el motor de la tabla hash de direcciones. El snapshot guarda
+        // las colisiones de la tabla con la que se construyó, así que sólo se usa con el motor
+        // predeterminado.
+        const char *engine = std::getenv("BITACORA_TABLA");
+        std::string engineName = (engine != nullptr) ? engine : "";
+
+        if (engineName.empty() || engineName == "cuadratica"){
+            analyze<HashTable<unsigned int, ipAddress>>(fileName, option, true);
+        }
+
+        else if (engineName == "fibonacci"){
+            analyze<HashTable<unsigned int, ipAddress, FibonacciHash, PowerOfTwoSizing>>(fileName, option, false);
+        }
+
+        else if (engineName == "mix64"){
+            analyze<HashTable<unsigned int, ipAddress, Mix64Hash, PowerOfTwoSizing>>(fileName, option, false);
+        }
 
-        std::cout << "\nIngrese la direccion IP en formato string del cual desea obtener su resumen: ";
-        std::cin >> searchedIp;
-        graph.getIPSummary(searchedIp);
+        else if (engineName == "segura"){
+            analyze<HashTable<unsigned int, ipAddress, KeyedHash, PrimeSizing>>(fileName, option, false);
+        }
+
+        else if (engineName == "swiss"){
+            analyze<SwissHashTable<unsigned int, ipAddress>>(fileName, option, false);
+        }
+
+        else if (engineName == "cuckoo"){
+            analyze<CuckooHashTable<unsigned int, ipAddress>>(fileName, option, false);
+        }
+
+        else if (engineName == "concurrente"){
+            analyze<ConcurrentHashTable<unsigned int, ipAddress>>(fileName, option, false);
+        }
+
+        else{
+            throw std::invalid_argument("Motor de tabla hash desconocido: " + engineName);
+        }
     }
 
     catch (const std::exception &e){
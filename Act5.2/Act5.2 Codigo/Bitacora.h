@@ -1,6 +1,7 @@
 #ifndef _BITACORA_H_
 #define _BITACORA_H_
 
+#include <cstdlib>
 #include <vector>
 #include <fstream>
 #include <stdexcept>
@@ -9,9 +10,35 @@
 
 class Bitacora{
 private:
-    Graph<std::string> graph;
     std::string searchedIp;
 
+    /*
+     * Descripción: analyze()
+     *      Construye (o carga de un snapshot) el grafo de la bitácora con el motor de tabla hash
+     *      Table, imprime las colisiones y muestra el resumen de la dirección IP que ingresa el
+     *      usuario.
+     *
+     * Parámetros de entrada:
+     *      @fileName: nombre del archivo de bitácora.
+     *
+     *      @option: opción de tamaño de la tabla hash (0 a 5). De 1 a 5 la tabla usa uno de los
+     *      5 números primos más cercanos al número de direcciones como tamaño fijo; con 0 inicia
+     *      con el tamaño que corresponde al número de direcciones y crece sola al superar su
+     *      factor de carga.
+     *
+     *      @allowSnapshot: true si se puede usar BITACORA_SNAPSHOT (y BITACORA_IMAGEN_HASH) con
+     *      este motor.
+     *
+     * Valor de retorno:
+     *      No retorna ningún valor.
+     *
+     * Complejidad temporal:
+     *      O(n log n + m) donde n es el número de nodos y m el número de aristas.
+     */
+
+    template <class Table>
+    void analyze(std::string fileName, int option, bool allowSnapshot);
+
 public:
 
     /*
@@ -38,18 +65,54 @@ public:
      *      representa el nombre del archivo de bitácora que se leerá para construir la tabla
      *      hash en el objeto graph. El constructor realiza las siguientes operaciones:
      *
-     *      - Se solicita al usuario que ingrese un número del 1 al 5 para determinar el tamaño máximo
+     *      - Se solicita al usuario que ingrese un número del 0 al 5 para determinar el tamaño máximo
      *        (MaxSize) de la tabla hash. Estos números representan los 5 números primos mayores más cercanos
-     *        al número de direcciones IP presentes en la bitácora.
+     *        al número de direcciones IP presentes en la bitácora. Con 0 la tabla inicia con el tamaño
+     *        que corresponde al número de direcciones y crece sola al superar su factor de carga.
      *
      *      - Se utiliza el objeto graph para leer el archivo de bitácora como un grafo dirigido y construir
      *      la tabla hash con el tamaño determinado por la opción ingresada.
      *
      *      - Se invoca el método getHashT() para obtener la tabla hash construida.
+
+     *      - Si existe la variable de entorno BITACORA_SNAPSHOT, el grafo se carga del snapshot
+     *        indicado cuando corresponde a la bitácora; en caso contrario se construye y se guarda.
+
+     *      - Si existe la variable de entorno BITACORA_IMAGEN_HASH (y no se cargó un snapshot), la
+     *        tabla hash se mapea de la imagen indicada en lugar de reconstruirse con getHashT();
+     *        si la imagen no existe o no corresponde a la bitácora, se construye y se guarda. Sólo
+     *        se usa con el motor predeterminado y sin BITACORA_AGREGAR.
+
+     *      - Si existe la variable de entorno BITACORA_COMPRIMIR, la lista de adyacencia se guarda
+     *        comprimida (en este modo no se escriben snapshots).
+
+     *      - Si existe la variable de entorno BITACORA_AGREGAR, las conexiones repetidas entre dos
+     *        direcciones se fusionan y los resúmenes muestran cada dirección vecina una vez con sus
+     *        conexiones, peso total y primera y última fecha (en este modo no se usan snapshots).
+     *
+     *      - La variable de entorno BITACORA_TABLA elige el motor de la tabla hash: "cuadratica"
+     *        (HashTable, predeterminado), "fibonacci" o "mix64" (HashTable con ese hash y tamaño
+     *        potencia de dos), "segura" (HashTable con SipHash y llave secreta aleatoria, que
+     *        resiste direcciones elegidas para chocar), "swiss" (SwissHashTable), "cuckoo"
+     *        (CuckooHashTable, con búsquedas de peor caso acotado) o "concurrente"
+     *        (ConcurrentHashTable, que inserta en paralelo con los hilos de BITACORA_HILOS). Los
+     *        snapshots sólo se usan con el motor predeterminado.
+     *
+     *      - Si existe la variable de entorno BITACORA_HASH_PERFECTO, se construye un hash perfecto
+     *        mínimo de las IP cargadas y las consultas lo usan en lugar de la tabla hash.
+     *
+     *      - Si existe la variable de entorno BITACORA_ESTADISTICAS, con las colisiones (y en el
+     *        reporte de políticas) se imprimen los histogramas de sondeo, el factor de carga, las
+     *        tumbas y los tamaños de las listas de desbordamiento.
+     *
+     *      - Si existe la variable de entorno BITACORA_REPORTE_HASH, después de las colisiones se
+     *        imprime la comparación de políticas de hash y tamaño con las IP de la bitácora.
      *
      *      - Se invoca el método printCollisions() para imprimir las colisiones presentes en la tabla hash.
      *
      *      - Se solicita al usuario que ingrese una dirección IP en formato string para obtener su resumen.
+
+     *      - Se invoca el método getIPInSummary() para mostrar las direcciones que accedieron a esa IP.
      *
      *      - Se captura cualquier excepción que pueda ocurrir durante la ejecución del código y se imprime un
      *        mensaje de error en caso de que ocurra alguna excepción.
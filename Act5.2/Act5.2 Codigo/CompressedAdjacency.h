@@ -0,0 +1,313 @@
+#ifndef _COMPRESSED_ADJACENCY_H_
+#define _COMPRESSED_ADJACENCY_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+#include "MemoryTracker.h"
+#include "ThreadPool.h"
+
+/*
+ * Descripción:
+ *      Lista de adyacencia comprimida. Los vecinos de cada nodo se ordenan de menor a mayor y
+ *      se guardan como diferencias respecto al vecino anterior codificadas en varint (7 bits
+ *      por byte), de modo que vecinos cercanos ocupan uno o dos bytes en lugar de cuatro. Los
+ *      pesos se guardan en el mismo orden con un ancho fijo de 1, 2 o 4 bytes, el menor que
+ *      alcanza para el peso más grande del grafo (en codificación zigzag para admitir pesos
+ *      negativos). La decodificación se hace al recorrer los vecinos, sin descomprimir la
+ *      lista completa.
+ *
+ * Complejidad temporal:
+ *      O(g) para recorrer los g vecinos de un nodo.
+ */
+
+class CompressedAdjacency{
+private:
+    std::vector<int, TrackingAllocator<int, MemoryTag::Adjacency>> edgeOffsets;
+    std::vector<std::uint64_t, TrackingAllocator<std::uint64_t, MemoryTag::Adjacency>> byteOffsets;
+    std::vector<std::uint8_t, TrackingAllocator<std::uint8_t, MemoryTag::Adjacency>> neighborBytes;
+    std::vector<std::uint8_t, TrackingAllocator<std::uint8_t, MemoryTag::Adjacency>> weightBytes;
+    int weightWidth;
+
+    static std::uint32_t zigzag(int value);
+    static int unzigzag(std::uint32_t value);
+    static int varintLength(std::uint32_t value);
+
+    /*
+     * Descripción: sortedNeighbors()
+     *      Copia los vecinos y pesos de un nodo y los ordena por vecino (y por peso en caso de
+     *      empate, para que el resultado sea determinista).
+     *
+     * Parámetros de entrada:
+     *      @begin, @end: rango de aristas del nodo en los arreglos CSR.
+     *
+     *      @neighbors, @weights: arreglos CSR de vecinos y pesos.
+     *
+     *      @out: vector donde se guardan las parejas (vecino, peso) ordenadas.
+     *
+     * Valor de retorno:
+     *      No retorna ningún valor.
+     *
+     * Complejidad temporal:
+     *      O(g log g) donde g es el grado del nodo.
+     */
+
+    static void sortedNeighbors(int begin, int end, const int *neighbors, const int *weights, std::vector<std::pair<int, int>> &out);
+
+public:
+
+    /*
+     * Descripción:
+     *      Constructor de la lista comprimida. Crea una lista vacía.
+     *
+     * Parámetros de entrada:
+     *      No posee parámetros de entrada.
+     *
+     * Valor de retorno:
+     *      No retorna ningún valor.
+     *
+     * Complejidad temporal:
+     *      O(1)
+     */
+
+    CompressedAdjacency();
+
+    /*
+     * Descripción: build()
+     *      Construye la lista comprimida a partir de una lista de adyacencia en formato CSR.
+     *      Primero calcula en paralelo cuántos bytes ocupa cada nodo, después obtiene los
+     *      desplazamientos con una suma prefija y finalmente codifica cada nodo en paralelo.
+     *
+     * Parámetros de entrada:
+     *      @numNodes: número de nodos.
+     *
+     *      @offsets: desplazamientos CSR (numNodes + 1 elementos).
+     *
+     *      @neighbors: vecinos CSR.
+     *
+     *      @weights: pesos CSR.
+     *
+     * Valor de retorno:
+     *      No retorna ningún valor.
+     *
+     * Complejidad temporal:
+     *      O(m log d / h) donde m es el número de aristas, d el grado máximo y h el número
+     *      de hilos.
+     */
+
+    void build(int numNodes, const int *offsets, const int *neighbors, const int *weights);
+
+    /*
+     * Descripción: degree()
+     *      Devuelve el número de aristas del nodo.
+     *
+     * Parámetros de entrada:
+     *      @u: índice del nodo.
+     *
+     * Valor de retorno:
+     *      Número de aristas.
+     *
+     * Complejidad temporal:
+     *      O(1)
+     */
+
+    int degree(int u) const;
+
+    /*
+     * Descripción: forEach()
+     *      Decodifica los vecinos del nodo en orden creciente e invoca
+     *      visit(vecino, peso, posición) para cada uno, donde posición es el índice de la
+     *      arista en la lista completa ordenada por nodo y por vecino.
+     *
+     * Parámetros de entrada:
+     *      @u: índice del nodo.
+     *
+     *      @visit: función que recibe el vecino, el peso y la posición de cada arista.
+     *
+     * Valor de retorno:
+     *      No retorna ningún valor.
+     *
+     * Complejidad temporal:
+     *      O(g) donde g es el grado del nodo.
+     */
+
+    template <class Visitor>
+    void forEach(int u, Visitor visit) const;
+
+    /*
+     * Descripción: getBytes()
+     *      Devuelve los bytes que ocupan los arreglos de la lista comprimida.
+     *
+     * Parámetros de entrada:
+     *      No posee parámetros de entrada.
+     *
+     * Valor de retorno:
+     *      Número de bytes.
+     *
+     * Complejidad temporal:
+     *      O(1)
+     */
+
+    std::size_t getBytes() const;
+
+    /*
+     * Descripción: clear()
+     *      Libera la lista comprimida.
+     *
+     * Parámetros de entrada:
+     *      No posee parámetros de entrada.
+     *
+     * Valor de retorno:
+     *      No retorna ningún valor.
+     *
+     * Complejidad temporal:
+     *      O(1)
+     */
+
+    void clear();
+};
+
+inline CompressedAdjacency::CompressedAdjacency(){
+    weightWidth = 1;
+}
+
+inline std::uint32_t CompressedAdjacency::zigzag(int value){
+    return ((std::uint32_t)value << 1) ^ (std::uint32_t)(value >> 31);
+}
+
+inline int CompressedAdjacency::unzigzag(std::uint32_t value){
+    return (int)(value >> 1) ^ -(int)(value & 1);
+}
+
+inline int CompressedAdjacency::varintLength(std::uint32_t value){
+    int length = 1;
+
+    while (value >= 0x80){
+        value >>= 7;
+        length++;
+    }
+
+    return length;
+}
+
+inline void CompressedAdjacency::sortedNeighbors(int begin, int end, const int *neighbors, const int *weights, std::vector<std::pair<int, int>> &out){
+    out.clear();
+
+    for (int e = begin; e < end; e++){
+        out.push_back(std::make_pair(neighbors[e], weights[e]));
+    }
+
+    std::sort(out.begin(), out.end());
+}
+
+inline void CompressedAdjacency::build(int numNodes, const int *offsets, const int *neighbors, const int *weights){
+    int numEdges = offsets[numNodes];
+    std::uint32_t maxWeight = 0;
+
+    for (int e = 0; e < numEdges; e++){
+        maxWeight = std::max(maxWeight, zigzag(weights[e]));
+    }
+
+    weightWidth = (maxWeight < 0x100u) ? 1 : (maxWeight < 0x10000u ? 2 : 4);
+    edgeOffsets.assign(offsets, offsets + numNodes + 1);
+    byteOffsets.assign(numNodes + 1, 0);
+    weightBytes.assign((std::size_t)numEdges * weightWidth, 0);
+
+    parallelFor(0, numNodes, 1024, [this, offsets, neighbors, weights](int begin, int end){
+        std::vector<std::pair<int, int>> edges;
+
+        for (int u = begin; u < end; u++){
+            sortedNeighbors(offsets[u], offsets[u + 1], neighbors, weights, edges);
+            std::uint64_t bytes = 0;
+            int previous = 0;
+
+            for (const std::pair<int, int> &edge : edges){
+                bytes += varintLength((std::uint32_t)(edge.first - previous));
+                previous = edge.first;
+            }
+
+            byteOffsets[u + 1] = bytes;
+        }
+    });
+
+    for (int u = 0; u < numNodes; u++){
+        byteOffsets[u + 1] += byteOffsets[u];
+    }
+
+    neighborBytes.assign(byteOffsets[numNodes], 0);
+
+    parallelFor(0, numNodes, 1024, [this, offsets, neighbors, weights](int begin, int end){
+        std::vector<std::pair<int, int>> edges;
+
+        for (int u = begin; u < end; u++){
+            sortedNeighbors(offsets[u], offsets[u + 1], neighbors, weights, edges);
+            std::uint8_t *out = neighborBytes.data() + byteOffsets[u];
+            std::uint8_t *weightOut = weightBytes.data() + (std::size_t)offsets[u] * weightWidth;
+            int previous = 0;
+
+            for (const std::pair<int, int> &edge : edges){
+                std::uint32_t delta = (std::uint32_t)(edge.first - previous);
+                previous = edge.first;
+
+                while (delta >= 0x80){
+                    *out++ = (std::uint8_t)(delta | 0x80);
+                    delta >>= 7;
+                }
+
+                *out++ = (std::uint8_t)delta;
+
+                std::uint32_t weight = zigzag(edge.second);
+
+                for (int b = 0; b < weightWidth; b++){
+                    *weightOut++ = (std::uint8_t)(weight >> (8 * b));
+                }
+            }
+        }
+    });
+}
+
+inline int CompressedAdjacency::degree(int u) const{
+    return edgeOffsets[u + 1] - edgeOffsets[u];
+}
+
+template <class Visitor>
+void CompressedAdjacency::forEach(int u, Visitor visit) const{
+    const std::uint8_t *in = neighborBytes.data() + byteOffsets[u];
+    const std::uint8_t *weightIn = weightBytes.data() + (std::size_t)edgeOffsets[u] * weightWidth;
+    int previous = 0;
+
+    for (int e = edgeOffsets[u]; e < edgeOffsets[u + 1]; e++){
+        std::uint32_t delta = 0;
+        int shift = 0;
+
+        while (*in & 0x80){
+            delta |= (std::uint32_t)(*in++ & 0x7F) << shift;
+            shift += 7;
+        }
+
+        delta |= (std::uint32_t)(*in++) << shift;
+        previous += (int)delta;
+
+        std::uint32_t weight = weightIn[0];
+        weight |= (weightWidth > 1) ? ((std::uint32_t)weightIn[1] << 8) : 0;
+        weight |= (weightWidth > 2) ? ((std::uint32_t)weightIn[2] << 16) | ((std::uint32_t)weightIn[3] << 24) : 0;
+        weightIn += weightWidth;
+
+        visit(previous, unzigzag(weight), e);
+    }
+}
+
+inline std::size_t CompressedAdjacency::getBytes() const{
+    return edgeOffsets.size() * sizeof(int) + byteOffsets.size() * sizeof(std::uint64_t) + neighborBytes.size() + weightBytes.size();
+}
+
+inline void CompressedAdjacency::clear(){
+    edgeOffsets.clear();
+    byteOffsets.clear();
+    neighborBytes.clear();
+    weightBytes.clear();
+}
+
+#endif // _COMPRESSED_ADJACENCY_H_
@@ -0,0 +1,467 @@
+#ifndef _CONCURRENT_HASH_TABLE_H_
+#define _CONCURRENT_HASH_TABLE_H_
+
+#include <atomic>
+#include <cstdint>
+#include <iostream>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+#include "HashPolicies.h"
+#include "MemoryTracker.h"
+#include "ThreadPool.h"
+
+/*
+ * Descripción:
+ *      Tabla hash concurrente con la misma interfaz que HashTable. Usa direccionamiento
+ *      abierto con sondeo lineal sobre un número de casillas potencia de dos y un byte de
+ *      control atómico por casilla: vacía, reservada (un hilo está escribiendo la llave y el
+ *      valor) u ocupada. Para insertar, un hilo reserva una casilla vacía con una
+ *      operación compare-and-swap, escribe la llave y el valor y publica la casilla como
+ *      ocupada con semántica release; varios hilos pueden insertar al mismo tiempo sin
+ *      candados. find() sólo hace lecturas acquire de los controles y nunca espera: las
+ *      casillas reservadas se saltan, porque su inserción todavía no termina, y el sondeo
+ *      está acotado por el número de casillas, así que cualquier número de hilos puede
+ *      consultar la tabla a la vez.
+ *
+ *      remove() no deja marcas de borrado: recorre hacia atrás los elementos del mismo grupo
+ *      de casillas para cerrar el hueco, de modo que las casillas liberadas se reutilizan y
+ *      las búsquedas fallidas siguen terminando en la primera casilla vacía. Por eso, igual
+ *      que setMaxSize(), remove() no debe invocarse mientras otros hilos usan la tabla, y
+ *      los índices obtenidos con find() dejan de ser válidos después de un remove().
+ *
+ *      El tamaño se fija con setMaxSize() o setAutomaticSize() antes de insertar (con factor
+ *      de carga de 0.5 o menos); la tabla no crece mientras otros hilos la usan.
+ *
+ * Complejidad temporal:
+ *      O(1) en promedio por inserción, búsqueda y eliminación.
+ */
+
+template <class K, class T>
+class ConcurrentHashTable{
+private:
+    static constexpr std::uint8_t SLOT_EMPTY = 0;
+    static constexpr std::uint8_t SLOT_RESERVED = 1;
+    static constexpr std::uint8_t SLOT_FULL = 2;
+
+    std::vector<std::atomic<std::uint8_t>, TrackingAllocator<std::atomic<std::uint8_t>, MemoryTag::HashTable>> states;
+    std::vector<K, TrackingAllocator<K, MemoryTag::HashTable>> keys;
+    std::vector<T, TrackingAllocator<T, MemoryTag::HashTable>> values;
+    int capacity;
+    int maxSize;
+    std::atomic<int> numElements;
+    std::atomic<int> numCollisions;
+
+    /*
+     * Descripción: waitPublished()
+     *      Espera a que termine la escritura de una casilla reservada por otro hilo y devuelve
+     *      su nuevo estado. Sólo la usa add(), que necesita conocer la llave de la casilla
+     *      para no insertar una llave repetida.
+     *
+     * Parámetros de entrada:
+     *      @slot: índice de la casilla.
+     *
+     * Valor de retorno:
+     *      Estado de la casilla después de publicarse.
+     *
+     * Complejidad temporal:
+     *      O(1) salvo la espera a que el otro hilo termine su escritura.
+     */
+
+    std::uint8_t waitPublished(int slot) const;
+
+public:
+
+    /*
+     * Descripción:
+     *      Constructor de la tabla. Crea una tabla vacía sin casillas.
+     *
+     * Parámetros de entrada:
+     *      No posee parámetros de entrada.
+     *
+     * Valor de retorno:
+     *      No retorna ningún valor.
+     *
+     * Complejidad temporal:
+     *      O(1)
+     */
+
+    ConcurrentHashTable();
+
+    /*
+     * Descripción: setMaxSize()
+     *      Vacía la tabla y reserva casillas para selectedMaxSize elementos: la potencia de dos
+     *      que mantiene el factor de carga en 0.5 o menos. No debe invocarse mientras otros
+     *      hilos usan la tabla.
+     *
+     * Parámetros de entrada:
+     *      @selectedMaxSize: número máximo de elementos.
+     *
+     * Valor de retorno:
+     *      No retorna ningún valor.
+     *
+     * Complejidad temporal:
+     *      O(n)
+     */
+
+    void setMaxSize(int selectedMaxSize);
+
+    /*
+     * Descripción: setAutomaticSize()
+     *      Equivalente a setMaxSize(expected): como la tabla no crece de forma concurrente,
+     *      el tamaño se toma del número de elementos esperado.
+     *
+     * Parámetros de entrada:
+     *      @expected: número de elementos esperado.
+     *
+     * Valor de retorno:
+     *      No retorna ningún valor.
+     *
+     * Complejidad temporal:
+     *      O(expected)
+     */
+
+    void setAutomaticSize(int expected);
+
+    /*
+     * Descripción: getHashIndex()
+     *      Calcula la casilla inicial de una llave con Mix64Hash.
+     *
+     * Parámetros de entrada:
+     *      @keyValue: llave a dispersar.
+     *
+     * Valor de retorno:
+     *      Índice de la casilla inicial.
+     *
+     * Complejidad temporal:
+     *      O(1)
+     */
+
+    int getHashIndex(K keyValue) const;
+
+    /*
+     * Descripción: getNumElements() / getNumCollisions() / getCapacity()
+     *      Devuelven el número de elementos, el número de casillas adicionales a la inicial
+     *      que se revisaron al insertar y el número de casillas.
+     *
+     * Parámetros de entrada:
+     *      No posee parámetros de entrada.
+     *
+     * Valor de retorno:
+     *      El conteo correspondiente.
+     *
+     * Complejidad temporal:
+     *      O(1)
+     */
+
+    int getNumElements() const;
+    int getNumCollisions() const;
+    int getCapacity() const;
+
+    /*
+     * Descripción: print()
+     *      Imprime las casillas ocupadas con su llave y su valor. No debe invocarse mientras
+     *      otros hilos insertan.
+     *
+     * Parámetros de entrada:
+     *      No posee parámetros de entrada.
+     *
+     * Valor de retorno:
+     *      No retorna ningún valor.
+     *
+     * Complejidad temporal:
+     *      O(n) donde n es el número de casillas.
+     */
+
+    void print();
+
+    /*
+     * Descripción: add()
+     *      Inserta un elemento; se puede invocar desde varios hilos a la vez. Lanza
+     *      std::out_of_range si la tabla está llena o si la llave ya existe.
+     *
+     * Parámetros de entrada:
+     *      @keyValue: llave del elemento.
+     *
+     *      @dataValue: valor asociado a la llave.
+     *
+     * Valor de retorno:
+     *      No retorna ningún valor.
+     *
+     * Complejidad temporal:
+     *      O(1) en promedio.
+     */
+
+    void add(K keyValue, T dataValue);
+
+    /*
+     * Descripción: find()
+     *      Busca una llave sin esperar a otros hilos (wait-free): a lo más revisa todas las
+     *      casillas una vez.
+     *
+     * Parámetros de entrada:
+     *      @keyValue: llave buscada.
+     *
+     * Valor de retorno:
+     *      Índice de la casilla de la llave, o -1 si no existe.
+     *
+     * Complejidad temporal:
+     *      O(1) en promedio.
+     */
+
+    int find(K keyValue) const;
+
+    /*
+     * Descripción: getDataAt()
+     *      Devuelve el valor de una casilla obtenida con find().
+     *
+     * Parámetros de entrada:
+     *      @index: índice de la casilla.
+     *
+     * Valor de retorno:
+     *      Valor de la casilla.
+     *
+     * Complejidad temporal:
+     *      O(1)
+     */
+
+    T getDataAt(int index) const;
+
+    /*
+     * Descripción: remove()
+     *      Elimina una llave y recorre hacia atrás los elementos siguientes de su grupo de
+     *      casillas que pueden ocupar el hueco (borrado con desplazamiento hacia atrás), sin
+     *      dejar marcas de borrado. No debe invocarse mientras otros hilos usan la tabla.
+     *      Lanza std::out_of_range si la llave no existe.
+     *
+     * Parámetros de entrada:
+     *      @keyValue: llave a eliminar.
+     *
+     * Valor de retorno:
+     *      No retorna ningún valor.
+     *
+     * Complejidad temporal:
+     *      O(1) en promedio.
+     */
+
+    void remove(K keyValue);
+};
+
+/*
+ * Descripción: insertAll()
+ *      Versión de insertAll() para ConcurrentHashTable: reparte las inserciones entre los
+ *      hilos del pool con parallelFor.
+ *
+ * Parámetros de entrada:
+ *      @table: tabla donde se insertan los elementos.
+ *
+ *      @count: número de elementos.
+ *
+ *      @keyOf: función que devuelve la llave del elemento i.
+ *
+ *      @valueOf: función que devuelve el valor del elemento i.
+ *
+ * Valor de retorno:
+ *      No retorna ningún valor.
+ *
+ * Complejidad temporal:
+ *      O(n / h) en promedio, donde h es el número de hilos.
+ */
+
+template <class K, class T, class KeyOf, class ValueOf>
+void insertAll(ConcurrentHashTable<K, T> &table, int count, KeyOf keyOf, ValueOf valueOf){
+    parallelFor(0, count, 1024, [&table, &keyOf, &valueOf](int begin, int end){
+
+        for (int i = begin; i < end; i++){
+            table.add(keyOf(i), valueOf(i));
+        }
+    });
+}
+
+template <class K, class T>
+ConcurrentHashTable<K, T>::ConcurrentHashTable(){
+    capacity = 0;
+    maxSize = 0;
+    numElements = 0;
+    numCollisions = 0;
+}
+
+template <class K, class T>
+void ConcurrentHashTable<K, T>::setMaxSize(int selectedMaxSize){
+    capacity = PowerOfTwoSizing::fixedCapacity(2 * (selectedMaxSize > 8 ? selectedMaxSize : 8));
+    maxSize = selectedMaxSize;
+    numElements = 0;
+    numCollisions = 0;
+    states = decltype(states)(capacity);
+
+    for (std::atomic<std::uint8_t> &state : states){
+        state.store(SLOT_EMPTY, std::memory_order_relaxed);
+    }
+
+    keys.assign(capacity, K());
+    values.assign(capacity, T());
+}
+
+template <class K, class T>
+void ConcurrentHashTable<K, T>::setAutomaticSize(int expected){
+    setMaxSize(expected);
+}
+
+template <class K, class T>
+int ConcurrentHashTable<K, T>::getHashIndex(K keyValue) const{
+    return PowerOfTwoSizing::home(Mix64Hash::hash((std::uint64_t)keyValue), capacity);
+}
+
+template <class K, class T>
+int ConcurrentHashTable<K, T>::getNumElements() const{
+    return numElements.load();
+}
+
+template <class K, class T>
+int ConcurrentHashTable<K, T>::getNumCollisions() const{
+    return numCollisions.load();
+}
+
+template <class K, class T>
+int ConcurrentHashTable<K, T>::getCapacity() const{
+    return capacity;
+}
+
+template <class K, class T>
+void ConcurrentHashTable<K, T>::print(){
+    std::cout << "Contenido de la tabla hash" << std::endl;
+
+    for (int i = 0; i < capacity; i++){
+
+        if (states[i].load(std::memory_order_acquire) == SLOT_FULL){
+            std::cout << "Celda: " << i << " Key: " << keys[i] << ", Value: " << values[i] << std::endl;
+        }
+    }
+}
+
+template <class K, class T>
+std::uint8_t ConcurrentHashTable<K, T>::waitPublished(int slot) const{
+    std::uint8_t state = states[slot].load(std::memory_order_acquire);
+
+    while (state == SLOT_RESERVED){
+        std::this_thread::yield();
+        state = states[slot].load(std::memory_order_acquire);
+    }
+
+    return state;
+}
+
+template <class K, class T>
+void ConcurrentHashTable<K, T>::add(K keyValue, T dataValue){
+
+    if (capacity == 0 || numElements.fetch_add(1) >= maxSize){
+
+        if (capacity != 0){
+            numElements.fetch_sub(1);
+        }
+
+        throw std::out_of_range("La hash table esta llena");
+    }
+
+    int slot = getHashIndex(keyValue);
+    int collisions = 0;
+
+    for (int step = 0; step < capacity; step++){
+        std::uint8_t state = waitPublished(slot);
+
+        if (state == SLOT_EMPTY){
+            std::uint8_t expected = SLOT_EMPTY;
+
+            if (states[slot].compare_exchange_strong(expected, SLOT_RESERVED, std::memory_order_acq_rel)){
+                keys[slot] = keyValue;
+                values[slot] = dataValue;
+                states[slot].store(SLOT_FULL, std::memory_order_release);
+                numCollisions.fetch_add(collisions, std::memory_order_relaxed);
+                return;
+            }
+
+            // Otro hilo reservó la casilla primero; se vuelve a revisar la misma casilla.
+            step--;
+            continue;
+        }
+
+        if (state == SLOT_FULL && keys[slot] == keyValue){
+            numElements.fetch_sub(1);
+            throw std::out_of_range("El elemento ya existe en la tabla hash");
+        }
+
+        collisions++;
+        slot = (slot + 1) & (capacity - 1);
+    }
+
+    numElements.fetch_sub(1);
+    throw std::out_of_range("La hash table esta llena");
+}
+
+template <class K, class T>
+int ConcurrentHashTable<K, T>::find(K keyValue) const{
+
+    if (capacity == 0){
+        return -1;
+    }
+
+    int slot = getHashIndex(keyValue);
+
+    for (int step = 0; step < capacity; step++){
+        std::uint8_t state = states[slot].load(std::memory_order_acquire);
+
+        if (state == SLOT_EMPTY){
+            return -1;
+        }
+
+        if (state == SLOT_FULL && keys[slot] == keyValue){
+            return slot;
+        }
+
+        slot = (slot + 1) & (capacity - 1);
+    }
+
+    return -1;
+}
+
+template <class K, class T>
+T ConcurrentHashTable<K, T>::getDataAt(int index) const{
+    return values[index];
+}
+
+template <class K, class T>
+void ConcurrentHashTable<K, T>::remove(K keyValue){
+    int hole = find(keyValue);
+
+    if (hole == -1){
+        throw std::out_of_range("El elemento no existe en la tabla hash");
+    }
+
+    int mask = capacity - 1;
+    int slot = hole;
+
+    while (true){
+        slot = (slot + 1) & mask;
+
+        if (states[slot].load(std::memory_order_relaxed) == SLOT_EMPTY){
+            break;
+        }
+
+        // El elemento de slot puede pasar al hueco si su casilla inicial no está en el tramo
+        // circular (hole, slot]; si no, al moverlo dejaría de encontrarse desde su inicio.
+        int home = getHashIndex(keys[slot]);
+
+        if (((slot - home) & mask) >= ((slot - hole) & mask)){
+            keys[hole] = keys[slot];
+            values[hole] = values[slot];
+            hole = slot;
+        }
+    }
+
+    keys[hole] = K();
+    values[hole] = T();
+    states[hole].store(SLOT_EMPTY, std::memory_order_release);
+    numElements.fetch_sub(1);
+}
+
+#endif // _CONCURRENT_HASH_TABLE_H_
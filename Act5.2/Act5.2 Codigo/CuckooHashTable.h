@@ -0,0 +1,609 @@
+#ifndef _CUCKOO_HASH_TABLE_H_
+#define _CUCKOO_HASH_TABLE_H_
+
+#include <cstdint>
+#include <iostream>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+#include "HashPolicies.h"
+#include "MemoryTracker.h"
+
+/*
+ * Descripción:
+ *      Tabla hash cuckoo por cubetas con la misma interfaz que HashTable. Cada llave tiene dos
+ *      cubetas posibles de BUCKET_SIZE casillas, calculadas con dos funciones hash (las dos
+ *      mitades de un hash de 64 bits), y siempre está en una de ellas o en un depósito
+ *      (stash) pequeño de STASH_SIZE casillas. find() revisa a lo más las dos cubetas (8
+ *      casillas contiguas de dos en dos) y, sólo si el depósito tiene elementos, sus
+ *      STASH_SIZE casillas: el peor caso de una búsqueda está acotado, sin listas ni
+ *      secuencias de sondeo.
+ *
+ *      Si las dos cubetas de una llave nueva están llenas, la llave desplaza a un elemento
+ *      de su cubeta, que se mueve a su otra cubeta, y así hasta MAX_KICKS veces. Si la cadena
+ *      no termina, el último elemento desplazado va al depósito; si el depósito está lleno,
+ *      los desplazamientos se deshacen y la tabla crece (con tamaño automático, cambiando
+ *      también las funciones hash) o lanza la excepción de tabla llena.
+ *
+ * Complejidad temporal:
+ *      O(1) en el peor caso por búsqueda; O(1) en promedio por inserción y eliminación.
+ */
+
+template <class K, class T>
+class CuckooHashTable{
+private:
+    static constexpr int BUCKET_SIZE = 4;
+    static constexpr int STASH_SIZE = 8;
+    static constexpr int MAX_KICKS = 256;
+
+    // Casillas de las cubetas seguidas de las STASH_SIZE casillas del depósito.
+    std::vector<std::uint8_t, TrackingAllocator<std::uint8_t, MemoryTag::HashTable>> used;
+    std::vector<K, TrackingAllocator<K, MemoryTag::HashTable>> keys;
+    std::vector<T, TrackingAllocator<T, MemoryTag::HashTable>> values;
+    int numBuckets;
+    int numElements;
+    int numCollisions;
+    int stashCount;
+    int maxSize;
+    bool autoGrow;
+    std::uint64_t seed;
+    std::uint32_t victimState;
+
+    /*
+     * Descripción: bucketsOf() / otherBucket()
+     *      Calculan las dos cubetas de una llave, y la cubeta alternativa de una llave que
+     *      está en la cubeta indicada.
+     *
+     * Parámetros de entrada:
+     *      @keyValue: llave.
+     *
+     *      @first / @second: referencias donde se guardan las dos cubetas.
+     *
+     *      @bucket: cubeta donde está la llave.
+     *
+     * Valor de retorno:
+     *      otherBucket() devuelve la otra cubeta de la llave.
+     *
+     * Complejidad temporal:
+     *      O(1)
+     */
+
+    void bucketsOf(K keyValue, int &first, int &second) const;
+    int otherBucket(K keyValue, int bucket) const;
+
+    /*
+     * Descripción: freeSlotIn()
+     *      Busca una casilla libre en una cubeta.
+     *
+     * Parámetros de entrada:
+     *      @bucket: índice de la cubeta.
+     *
+     * Valor de retorno:
+     *      Índice de la casilla libre, o -1 si la cubeta está llena.
+     *
+     * Complejidad temporal:
+     *      O(BUCKET_SIZE)
+     */
+
+    int freeSlotIn(int bucket) const;
+
+    /*
+     * Descripción: place()
+     *      Coloca un elemento nuevo en una de sus cubetas, desplazando elementos si hace
+     *      falta, o en el depósito.
+     *
+     * Parámetros de entrada:
+     *      @keyValue: llave del elemento.
+     *
+     *      @dataValue: valor del elemento.
+     *
+     * Valor de retorno:
+     *      true si el elemento quedó en la tabla; false si no hubo lugar, en cuyo caso la
+     *      tabla queda como estaba.
+     *
+     * Complejidad temporal:
+     *      O(1) en promedio; O(MAX_KICKS) en el peor caso.
+     */
+
+    bool place(K keyValue, T dataValue);
+
+    /*
+     * Descripción: grow()
+     *      Duplica el número de cubetas, cambia las funciones hash y vuelve a colocar todos
+     *      los elementos.
+     *
+     * Parámetros de entrada:
+     *      No posee parámetros de entrada.
+     *
+     * Valor de retorno:
+     *      No retorna ningún valor.
+     *
+     * Complejidad temporal:
+     *      O(n) en promedio.
+     */
+
+    void grow();
+
+    /*
+     * Descripción: resize()
+     *      Vacía la tabla y reserva el número de cubetas indicado más el depósito.
+     *
+     * Parámetros de entrada:
+     *      @buckets: número de cubetas (potencia de dos).
+     *
+     * Valor de retorno:
+     *      No retorna ningún valor.
+     *
+     * Complejidad temporal:
+     *      O(n) donde n es el número de casillas.
+     */
+
+    void resize(int buckets);
+
+public:
+
+    /*
+     * Descripción:
+     *      Constructor de la tabla. Crea una tabla vacía sin cubetas.
+     *
+     * Parámetros de entrada:
+     *      No posee parámetros de entrada.
+     *
+     * Valor de retorno:
+     *      No retorna ningún valor.
+     *
+     * Complejidad temporal:
+     *      O(1)
+     */
+
+    CuckooHashTable();
+
+    /*
+     * Descripción: setMaxSize()
+     *      Vacía la tabla y reserva cubetas para selectedMaxSize elementos con un factor de
+     *      carga de 0.9 o menos, donde la inserción cuckoo con cubetas de 4 casi nunca falla.
+     *
+     * Parámetros de entrada:
+     *      @selectedMaxSize: número máximo de elementos.
+     *
+     * Valor de retorno:
+     *      No retorna ningún valor.
+     *
+     * Complejidad temporal:
+     *      O(n)
+     */
+
+    void setMaxSize(int selectedMaxSize);
+
+    /*
+     * Descripción: setAutomaticSize()
+     *      Igual que setMaxSize(), pero la tabla crece cuando se llena o cuando una inserción
+     *      no encuentra lugar.
+     *
+     * Parámetros de entrada:
+     *      @expected: número de elementos esperado.
+     *
+     * Valor de retorno:
+     *      No retorna ningún valor.
+     *
+     * Complejidad temporal:
+     *      O(expected)
+     */
+
+    void setAutomaticSize(int expected);
+
+    /*
+     * Descripción: getHashIndex()
+     *      Devuelve la primera casilla de la primera cubeta de una llave.
+     *
+     * Parámetros de entrada:
+     *      @keyValue: llave.
+     *
+     * Valor de retorno:
+     *      Índice de la casilla, o -1 si la tabla no tiene cubetas.
+     *
+     * Complejidad temporal:
+     *      O(1)
+     */
+
+    int getHashIndex(K keyValue);
+
+    /*
+     * Descripción: getNumElements() / getNumCollisions() / getCapacity()
+     *      Devuelven el número de elementos, el número de desplazamientos (y elementos
+     *      enviados al depósito) desde el último cambio de tamaño y el número de casillas de
+     *      las cubetas.
+     *
+     * Parámetros de entrada:
+     *      No posee parámetros de entrada.
+     *
+     * Valor de retorno:
+     *      El conteo correspondiente.
+     *
+     * Complejidad temporal:
+     *      O(1)
+     */
+
+    int getNumElements();
+    int getNumCollisions();
+    int getCapacity();
+
+    /*
+     * Descripción: print()
+     *      Imprime las casillas ocupadas con su llave y su valor.
+     *
+     * Parámetros de entrada:
+     *      No posee parámetros de entrada.
+     *
+     * Valor de retorno:
+     *      No retorna ningún valor.
+     *
+     * Complejidad temporal:
+     *      O(n) donde n es el número de casillas.
+     */
+
+    void print();
+
+    /*
+     * Descripción: add()
+     *      Inserta un elemento. Lanza std::out_of_range si la llave ya existe o si la tabla
+     *      de tamaño fijo está llena.
+     *
+     * Parámetros de entrada:
+     *      @keyValue: llave del elemento.
+     *
+     *      @dataValue: valor asociado a la llave.
+     *
+     * Valor de retorno:
+     *      No retorna ningún valor.
+     *
+     * Complejidad temporal:
+     *      O(1) en promedio.
+     */
+
+    void add(K keyValue, T dataValue);
+
+    /*
+     * Descripción: find()
+     *      Busca una llave en sus dos cubetas y, si tiene elementos, en el depósito.
+     *
+     * Parámetros de entrada:
+     *      @keyValue: llave buscada.
+     *
+     * Valor de retorno:
+     *      Índice de la casilla de la llave, o -1 si no existe.
+     *
+     * Complejidad temporal:
+     *      O(1) en el peor caso.
+     */
+
+    int find(K keyValue);
+
+    /*
+     * Descripción: getDataAt()
+     *      Devuelve el valor de una casilla obtenida con find().
+     *
+     * Parámetros de entrada:
+     *      @index: índice de la casilla.
+     *
+     * Valor de retorno:
+     *      Valor de la casilla.
+     *
+     * Complejidad temporal:
+     *      O(1)
+     */
+
+    T getDataAt(int index);
+
+    /*
+     * Descripción: remove()
+     *      Libera la casilla de una llave. Lanza std::out_of_range si la llave no existe.
+     *
+     * Parámetros de entrada:
+     *      @keyValue: llave a eliminar.
+     *
+     * Valor de retorno:
+     *      No retorna ningún valor.
+     *
+     * Complejidad temporal:
+     *      O(1) en el peor caso.
+     */
+
+    void remove(K keyValue);
+};
+
+template <class K, class T>
+CuckooHashTable<K, T>::CuckooHashTable(){
+    numBuckets = 0;
+    numElements = 0;
+    numCollisions = 0;
+    stashCount = 0;
+    maxSize = 0;
+    autoGrow = false;
+    seed = 0;
+    victimState = 0x9E3779B9u;
+}
+
+template <class K, class T>
+void CuckooHashTable<K, T>::resize(int buckets){
+    numBuckets = buckets;
+    numElements = 0;
+    numCollisions = 0;
+    stashCount = 0;
+    int slots = numBuckets * BUCKET_SIZE + STASH_SIZE;
+    used.assign(slots, 0);
+    keys.assign(slots, K());
+    values.assign(slots, T());
+}
+
+template <class K, class T>
+void CuckooHashTable<K, T>::setMaxSize(int selectedMaxSize){
+    int minimum = selectedMaxSize > BUCKET_SIZE ? selectedMaxSize : BUCKET_SIZE;
+    int buckets = PowerOfTwoSizing::fixedCapacity((int)(((long long)minimum * 10 + 9 * BUCKET_SIZE - 1) / (9 * BUCKET_SIZE)));
+    // Con una sola cubeta las dos funciones hash darían la misma.
+    resize(buckets > 1 ? buckets : 2);
+    maxSize = selectedMaxSize;
+    autoGrow = false;
+}
+
+template <class K, class T>
+void CuckooHashTable<K, T>::setAutomaticSize(int expected){
+    setMaxSize(expected);
+    autoGrow = true;
+}
+
+template <class K, class T>
+void CuckooHashTable<K, T>::bucketsOf(K keyValue, int &first, int &second) const{
+    std::uint64_t hash = Mix64Hash::hash((std::uint64_t)keyValue ^ seed);
+    int mask = numBuckets - 1;
+    first = (int)(hash & (std::uint64_t)mask);
+    second = (int)((hash >> 32) & (std::uint64_t)mask);
+
+    if (second == first){
+        second = first ^ 1;
+    }
+}
+
+template <class K, class T>
+int CuckooHashTable<K, T>::otherBucket(K keyValue, int bucket) const{
+    int first, second;
+    bucketsOf(keyValue, first, second);
+    return (bucket == first) ? second : first;
+}
+
+template <class K, class T>
+int CuckooHashTable<K, T>::freeSlotIn(int bucket) const{
+
+    for (int k = 0; k < BUCKET_SIZE; k++){
+
+        if (!used[bucket * BUCKET_SIZE + k]){
+            return bucket * BUCKET_SIZE + k;
+        }
+    }
+
+    return -1;
+}
+
+template <class K, class T>
+int CuckooHashTable<K, T>::getHashIndex(K keyValue){
+
+    if (numBuckets == 0){
+        return -1;
+    }
+
+    int first, second;
+    bucketsOf(keyValue, first, second);
+    return first * BUCKET_SIZE;
+}
+
+template <class K, class T>
+int CuckooHashTable<K, T>::getNumElements(){
+    return numElements;
+}
+
+template <class K, class T>
+int CuckooHashTable<K, T>::getNumCollisions(){
+    return numCollisions;
+}
+
+template <class K, class T>
+int CuckooHashTable<K, T>::getCapacity(){
+    return numBuckets * BUCKET_SIZE;
+}
+
+template <class K, class T>
+void CuckooHashTable<K, T>::print(){
+    std::cout << "Contenido de la tabla hash" << std::endl;
+
+    for (int i = 0; i < (int)used.size(); i++){
+
+        if (used[i]){
+            std::cout << "Celda: " << i << " Key: " << keys[i] << ", Value: " << values[i] << std::endl;
+        }
+    }
+}
+
+template <class K, class T>
+bool CuckooHashTable<K, T>::place(K keyValue, T dataValue){
+    int first, second;
+    bucketsOf(keyValue, first, second);
+    int slot = freeSlotIn(first);
+
+    if (slot == -1){
+        slot = freeSlotIn(second);
+    }
+
+    if (slot != -1){
+        used[slot] = 1;
+        keys[slot] = keyValue;
+        values[slot] = dataValue;
+        return true;
+    }
+
+    // Cadena de desplazamientos: el elemento en mano toma una casilla de su cubeta y el que
+    // estaba ahí pasa a su otra cubeta. path guarda las casillas para poder deshacerla.
+    std::vector<int> path;
+    int bucket = first;
+    int kicks = 0;
+
+    for (; kicks < MAX_KICKS; kicks++){
+        victimState ^= victimState << 13;
+        victimState ^= victimState >> 17;
+        victimState ^= victimState << 5;
+        slot = bucket * BUCKET_SIZE + (int)(victimState % BUCKET_SIZE);
+        std::swap(keyValue, keys[slot]);
+        std::swap(dataValue, values[slot]);
+        path.push_back(slot);
+        bucket = otherBucket(keyValue, bucket);
+        int freeSlot = freeSlotIn(bucket);
+
+        if (freeSlot != -1){
+            used[freeSlot] = 1;
+            keys[freeSlot] = keyValue;
+            values[freeSlot] = dataValue;
+            numCollisions += kicks + 1;
+            return true;
+        }
+    }
+
+    if (stashCount < STASH_SIZE){
+        slot = numBuckets * BUCKET_SIZE;
+
+        while (used[slot]){
+            slot++;
+        }
+
+        used[slot] = 1;
+        keys[slot] = keyValue;
+        values[slot] = dataValue;
+        stashCount++;
+        numCollisions += kicks + 1;
+        return true;
+    }
+
+    for (int k = (int)path.size() - 1; k >= 0; k--){
+        std::swap(keyValue, keys[path[k]]);
+        std::swap(dataValue, values[path[k]]);
+    }
+
+    return false;
+}
+
+template <class K, class T>
+void CuckooHashTable<K, T>::grow(){
+    decltype(used) oldUsed;
+    decltype(keys) oldKeys;
+    decltype(values) oldValues;
+    oldUsed.swap(used);
+    oldKeys.swap(keys);
+    oldValues.swap(values);
+    int count = numElements;
+    int buckets = numBuckets * 2;
+    bool placed = false;
+
+    while (!placed){
+        seed += 0x9E3779B97F4A7C15ull;
+        resize(buckets);
+        placed = true;
+
+        for (std::size_t slot = 0; slot < oldUsed.size() && placed; slot++){
+            placed = !oldUsed[slot] || place(oldKeys[slot], oldValues[slot]);
+        }
+
+        // Muy improbable con el doble de cubetas; si pasa se prueba con otras funciones hash
+        // y el doble de cubetas otra vez.
+        buckets *= 2;
+    }
+
+    numElements = count;
+    maxSize = numBuckets * BUCKET_SIZE * 9 / 10;
+}
+
+template <class K, class T>
+void CuckooHashTable<K, T>::add(K keyValue, T dataValue){
+
+    if (find(keyValue) != -1){
+        throw std::out_of_range("El elemento ya existe en la tabla hash");
+    }
+
+    if (numElements >= maxSize){
+
+        if (!autoGrow){
+            throw std::out_of_range("La hash table esta llena");
+        }
+
+        grow();
+    }
+
+    while (!place(keyValue, dataValue)){
+
+        if (!autoGrow){
+            throw std::out_of_range("La hash table esta llena");
+        }
+
+        grow();
+    }
+
+    numElements++;
+}
+
+template <class K, class T>
+int CuckooHashTable<K, T>::find(K keyValue){
+
+    if (numBuckets == 0){
+        return -1;
+    }
+
+    int first, second;
+    bucketsOf(keyValue, first, second);
+
+    for (int k = 0; k < BUCKET_SIZE; k++){
+        int slot = first * BUCKET_SIZE + k;
+
+        if (used[slot] && keys[slot] == keyValue){
+            return slot;
+        }
+    }
+
+    for (int k = 0; k < BUCKET_SIZE; k++){
+        int slot = second * BUCKET_SIZE + k;
+
+        if (used[slot] && keys[slot] == keyValue){
+            return slot;
+        }
+    }
+
+    for (int k = 0; k < STASH_SIZE && stashCount > 0; k++){
+        int slot = numBuckets * BUCKET_SIZE + k;
+
+        if (used[slot] && keys[slot] == keyValue){
+            return slot;
+        }
+    }
+
+    return -1;
+}
+
+template <class K, class T>
+T CuckooHashTable<K, T>::getDataAt(int index){
+    return values[index];
+}
+
+template <class K, class T>
+void CuckooHashTable<K, T>::remove(K keyValue){
+    int pos = find(keyValue);
+
+    if (pos == -1){
+        throw std::out_of_range("El elemento no existe en la tabla hash");
+    }
+
+    used[pos] = 0;
+    values[pos] = T();
+    numElements--;
+
+    if (pos >= numBuckets * BUCKET_SIZE){
+        stashCount--;
+    }
+}
+
+#endif // _CUCKOO_HASH_TABLE_H_
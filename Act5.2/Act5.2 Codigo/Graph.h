@@ -2,6 +2,7 @@
 #define _GRAPH_H_
 
 #include <iostream>
+#include <iomanip>
 #include <sstream>
 #include <vector>
 #include <string>
@@ -9,25 +10,108 @@
 #include <map>
 #include <set>
 #include <queue>
-#include "LinkedList.h"
+#include <atomic>
+#include <algorithm>
+#include <fstream>
+#include <string_view>
+#include <cstring>
 #include "IpAddress.h"
 #include "HashTable.h"
+#include "SwissHashTable.h"
+#include "ConcurrentHashTable.h"
+#include "CuckooHashTable.h"
+#include "PerfectHash.h"
+#include "HashPolicyReport.h"
+#include "IpIndexMap.h"
+#include "NodeStore.h"
+#include "GraphSnapshot.h"
+#include "HashTableImage.h"
+#include "CompressedAdjacency.h"
+#include "PeerSummary.h"
 #include "Numbers.h"
+#include "Tracer.h"
+#include "PerfCounters.h"
+#include "MemoryTracker.h"
+#include "ThreadPool.h"
 
 
-template <class T>
+template <class Table = HashTable<unsigned int, ipAddress>>
 class Graph{
 private:
+    struct Edge{
+        int source;
+        int target;
+        int weight;
+        // Fecha de la línea codificada con parseLogTime().
+        int timestamp;
+    };
+
+    typedef std::vector<Edge, TrackingAllocator<Edge, MemoryTag::Adjacency>> EdgeBuffer;
+
+    // Tamaño de los bloques en que readGraph() lee la sección de aristas.
+    static const std::size_t EDGE_BLOCK_BYTES = 8 << 20;
+
     int numNodes;
     int numEdges;
     int directedGraph;
     int weightedGraph;
     int sizeHT;
-    std::map<int, T> nodesInfo;
-    std::vector<ipAddress> ips;
+    // Nodos ordenados por valor de IP en formato de estructura de arreglos.
+    NodeStore ips;
+    // Arreglos densos que relacionan el índice del nodo en la bitácora con su posición en
+    // ips (posById) y la posición en ips con su celda en hashTableIp (hashSlot).
+    std::vector<int, TrackingAllocator<int, MemoryTag::Records>> posById;
+    std::vector<int, TrackingAllocator<int, MemoryTag::HashTable>> hashSlot;
     std::vector<int> vecSizeHash;
-    std::vector<LinkedList<std::pair<int, int>>> adjList;
-    HashTable<unsigned int, ipAddress> hashTableIp;
+    // Lista de adyacencia en formato CSR (compressed sparse row): las aristas que salen
+    // del nodo u ocupan las posiciones [adjOffsets[u], adjOffsets[u + 1]) de adjNeighbors
+    // y adjWeights, de modo que recorrer los vecinos es una lectura secuencial.
+    std::vector<int, TrackingAllocator<int, MemoryTag::Adjacency>> adjOffsets;
+    std::vector<int, TrackingAllocator<int, MemoryTag::Adjacency>> adjNeighbors;
+    std::vector<int, TrackingAllocator<int, MemoryTag::Adjacency>> adjWeights;
+
+    // Lista de adyacencia inversa en el mismo formato: las aristas que llegan al nodo v
+    // ocupan [inOffsets[v], inOffsets[v + 1]) de inNeighbors (nodo origen) e inWeights.
+    std::vector<int, TrackingAllocator<int, MemoryTag::Adjacency>> inOffsets;
+    std::vector<int, TrackingAllocator<int, MemoryTag::Adjacency>> inNeighbors;
+    std::vector<int, TrackingAllocator<int, MemoryTag::Adjacency>> inWeights;
+    // Tabla hash de direcciones; el motor (HashTable, SwissHashTable, ...) es el parámetro
+    // Table de la plantilla y sólo debe ofrecer setMaxSize, add, find, getDataAt y
+    // getNumCollisions.
+    Table hashTableIp;
+
+    // Valor entero de cada IP -> posición en ips; se llena al terminar de leer los nodos.
+    IpIndexMap ipIndex;
+
+    // Alternativa opcional de sólo lectura a ipIndex y hashTableIp para las consultas: hash
+    // perfecto mínimo de las IP y la posición en ips de cada una de sus casillas.
+    PerfectHash ipPerfect;
+    std::vector<int, TrackingAllocator<int, MemoryTag::HashTable>> perfectPos;
+
+    // Alternativa opcional a hashTableIp: imagen de la tabla hash predeterminada mapeada en
+    // memoria (HashTableImage.h), que evita reconstruir la tabla en cada ejecución.
+    HashTableImage<ipAddress> hashImage;
+
+    // Las consultas leen los arreglos a través de view, que apunta a los vectores anteriores
+    // o a un snapshot mapeado en memoria (snapshot).
+    GraphView view;
+    GraphSnapshot snapshot;
+
+    // Modo opcional de adyacencia comprimida: reemplaza los arreglos CSR de vecinos y pesos.
+    bool compressed;
+    CompressedAdjacency compressedOut;
+    CompressedAdjacency compressedIn;
+
+    // Modo opcional de aristas agregadas: las conexiones repetidas entre el mismo par de
+    // direcciones se guardan como una sola arista con la suma de sus pesos. La arista
+    // agregada k es la posición k de la lista de salida; pairHits, pairFirstSeen y
+    // pairLastSeen guardan sus conexiones y su primera y última fecha, e inPairIds relaciona
+    // cada posición de la lista inversa con su arista agregada.
+    bool aggregated;
+    std::vector<int, TrackingAllocator<int, MemoryTag::Adjacency>> pairHits;
+    std::vector<int, TrackingAllocator<int, MemoryTag::Adjacency>> pairFirstSeen;
+    std::vector<int, TrackingAllocator<int, MemoryTag::Adjacency>> pairLastSeen;
+    std::vector<int, TrackingAllocator<int, MemoryTag::Adjacency>> inPairIds;
 
     /*
      * Descripción: split()
@@ -55,9 +139,9 @@ private:
     /*
      * Descripción: binarySearch()
      *      Método que implementa la búsqueda binaria para encontrar una dirección IP
-     *      (ipAddress) específica dentro de un vector de direcciones IP (ips). El método
-     *      busca la dirección IP 'key' en el vector 'ips' y devuelve su índice si se encuentra,
-     *      o -1 si no se encuentra.
+     *      (ipAddress) específica dentro de las direcciones IP ordenadas (ips). El método
+     *      busca el valor de la dirección IP 'key' en la columna de valores de 'ips' y devuelve
+     *      su índice si se encuentra, o -1 si no se encuentra.
      *
      * Parámetros de entrada:
      *      @key: Dirección IP que se desea buscar dentro del vector 'ips'.
@@ -73,6 +157,216 @@ private:
 
     int binarySearch(ipAddress Key);
 
+    /*
+     * Descripción: parseEdgeLine()
+     *      Extrae de una línea de arista ("Mes Día HH:MM:SS ipOrigen:puerto ipDestino:puerto
+     *      peso razón") el valor entero de ambas direcciones IP, el peso y la fecha, recorriendo
+     *      la línea por tokens separados por espacios sin crear cadenas temporales. Las
+     *      direcciones se convierten con ipAddress::parse() y la fecha con parseLogTime(); una
+     *      fecha que no se puede interpretar no invalida la línea y se guarda como -1. Un peso
+     *      que no cabe en un int sí la invalida, como lo hacía std::stoi.
+     *
+     * Parámetros de entrada:
+     *      @line: línea de la bitácora que describe una arista.
+     *
+     *      @valueU: referencia donde se guarda el valor de la IP de origen.
+     *
+     *      @valueV: referencia donde se guarda el valor de la IP de destino.
+     *
+     *      @weight: referencia donde se guarda el peso de la arista.
+     *
+     *      @timestamp: referencia donde se guarda la fecha codificada de la arista.
+     *
+     * Valor de retorno:
+     *      true si la línea tiene el formato esperado, false en caso contrario.
+     *
+     * Complejidad temporal:
+     *      O(l) donde l es la longitud de la línea.
+     */
+
+    static bool parseEdgeLine(std::string_view line, unsigned int &valueU, unsigned int &valueV, int &weight, int &timestamp);
+
+    /*
+     * Descripción: parseEdges()
+     *      Convierte un bloque de la sección de aristas de la bitácora en aristas (origen,
+     *      destino, peso). El texto se divide en partes que terminan en un salto de línea; cada
+     *      parte se procesa en un hilo del pool con su propio vector de aristas, de modo que no
+     *      hay escrituras compartidas, y al final los vectores se agregan al final de edges en
+     *      el orden de las partes para conservar el orden de la bitácora.
+     *
+     * Parámetros de entrada:
+     *      @text: bloque de líneas completas de la sección de aristas.
+     *
+     *      @edges: vector al que se agregan las aristas en el orden de la bitácora.
+     *
+     * Valor de retorno:
+     *      No retorna ningún valor. Lanza una excepción std::invalid_argument si alguna línea
+     *      no tiene el formato esperado o contiene una dirección que no es nodo del grafo.
+     *
+     * Complejidad temporal:
+     *      O(m / h) por hilo, donde m es el número de aristas y h el número de hilos.
+     */
+
+    void parseEdges(std::string_view text, EdgeBuffer &edges);
+
+    /*
+     * Descripción: buildAdjacency()
+     *      Construye la lista de adyacencia en formato CSR a partir de las aristas leídas
+     *      de la bitácora. Primero cuenta el grado de salida de cada nodo, luego calcula
+     *      los desplazamientos con una suma prefija y finalmente coloca cada arista en su
+     *      posición (ordenamiento por conteo), conservando el orden de la bitácora entre
+     *      las aristas de un mismo nodo. En el mismo recorrido construye la lista inversa
+     *      (aristas de entrada) usando el nodo destino como clave.
+     *
+     *      Con más de un hilo el conteo y la colocación se reparten entre los hilos con
+     *      contadores atómicos; como el orden de llegada a cada casilla es arbitrario, se
+     *      colocan índices de arista que después se ordenan dentro de cada nodo, lo que da
+     *      exactamente el mismo resultado que la versión secuencial.
+     *
+     * Parámetros de entrada:
+     *      @edges: vector con las aristas (origen, destino, peso) en el orden de la bitácora.
+     *
+     * Valor de retorno:
+     *      No retorna ningún valor.
+     *
+     * Complejidad temporal:
+     *      O(n + m) donde n es el número de nodos y m el número de aristas del grafo; con
+     *      varios hilos, O((n + m log d) / h) donde d es el grado máximo.
+     */
+
+    void buildAdjacency(const EdgeBuffer &edges);
+
+    /*
+     * Descripción: aggregateEdges()
+     *      Ordena las aristas por (origen, destino) y fusiona las que unen el mismo par de
+     *      direcciones en una sola arista cuyo peso es la suma de los pesos (limitada al rango
+     *      de int). Las conexiones y la primera y última fecha de cada arista agregada se
+     *      guardan en pairHits, pairFirstSeen y pairLastSeen, en el mismo orden que las
+     *      aristas resultantes, que queda ordenado por origen y destino.
+     *
+     * Parámetros de entrada:
+     *      @edges: aristas leídas de la bitácora; se reemplazan por las aristas agregadas.
+     *
+     * Valor de retorno:
+     *      No retorna ningún valor.
+     *
+     * Complejidad temporal:
+     *      O(m log m) donde m es el número de aristas.
+     */
+
+    void aggregateEdges(EdgeBuffer &edges);
+
+    /*
+     * Descripción: findPosition()
+     *      Convierte la dirección IP recibida a su valor entero y obtiene su posición en ips
+     *      mediante el diccionario ipIndex, o con el hash perfecto si ya se construyó.
+     *
+     * Parámetros de entrada:
+     *      @searchedIp: dirección IP en formato "A.B.C.D".
+     *
+     * Valor de retorno:
+     *      Posición de la dirección en ips, o -1 si no pertenece al grafo. Lanza una excepción
+     *      std::invalid_argument si la dirección no es válida.
+     *
+     * Complejidad temporal:
+     *      O(1) en promedio.
+     */
+
+    int findPosition(const std::string &searchedIp);
+
+    /*
+     * Descripción: refreshView()
+     *      Actualiza view para que apunte a los vectores construidos por readGraph() y getHashT().
+     *
+     * Parámetros de entrada:
+     *      No posee parámetros de entrada.
+     *
+     * Valor de retorno:
+     *      No retorna ningún valor.
+     *
+     * Complejidad temporal:
+     *      O(1)
+     */
+
+    void refreshView();
+
+    /*
+     * Descripción: materializeNode()
+     *      Construye el objeto ipAddress del nodo en la posición indicada a partir de view.
+     *
+     * Parámetros de entrada:
+     *      @pos: posición del nodo en el orden por valor de IP.
+     *
+     * Valor de retorno:
+     *      Objeto ipAddress con el texto, el índice y los grados del nodo.
+     *
+     * Complejidad temporal:
+     *      O(l) donde l es la longitud del texto de la IP.
+     */
+
+    ipAddress materializeNode(int pos);
+
+    /*
+     * Descripción: forEachOutNeighbor() / forEachInNeighbor()
+     *      Recorren las aristas de salida o de entrada de un nodo e invocan
+     *      visit(vecino, peso, posición) para cada una, leyendo de view o, en modo comprimido,
+     *      decodificando la lista comprimida sobre la marcha.
+     *
+     * Parámetros de entrada:
+     *      @u: índice del nodo en la bitácora.
+     *
+     *      @visit: función que recibe el índice del vecino en la bitácora, el peso y la
+     *      posición de la arista en la lista recorrida.
+     *
+     * Valor de retorno:
+     *      No retorna ningún valor.
+     *
+     * Complejidad temporal:
+     *      O(g) donde g es el número de aristas recorridas.
+     */
+
+    template <class Visitor>
+    void forEachOutNeighbor(int u, Visitor visit);
+
+    template <class Visitor>
+    void forEachInNeighbor(int u, Visitor visit);
+
+    /*
+     * Descripción: printSortedPeers()
+     *      Vacía el heap imprimiendo un renglón numerado por elemento, de mayor a menor.
+     *
+     * Parámetros de entrada:
+     *      @peers: heap con las direcciones del resumen.
+     *
+     * Valor de retorno:
+     *      No retorna ningún valor.
+     *
+     * Complejidad temporal:
+     *      O(g log g) donde g es el número de elementos del heap.
+     */
+
+    template <class Item>
+    void printSortedPeers(MaxHeap<Item> &peers);
+
+    /*
+     * Descripción: summarizePeers()
+     *      Construye y muestra la lista de vecinos de un nodo en el modo de aristas agregadas:
+     *      un renglón por dirección vecina con sus conexiones, peso total y fechas.
+     *
+     * Parámetros de entrada:
+     *      @u: índice del nodo en la bitácora.
+     *
+     *      @outgoing: true para las aristas de salida, false para las de entrada.
+     *
+     * Valor de retorno:
+     *      No retorna ningún valor.
+     *
+     * Complejidad temporal:
+     *      O(p log p) donde p es el número de direcciones vecinas distintas.
+     */
+
+    void summarizePeers(int u, bool outgoing);
+
 public:
 
     /*
@@ -97,8 +391,8 @@ public:
      * Descripción:
      *      Destructor de la clase Graph. Se utiliza para liberar la memoria y realizar
      *      limpieza antes de que un objeto de la clase Graph sea eliminado. Se libera la 
-     *      memoria de la lista de adyacencia (adjList). Además, restablece los valores 
-     *      miembro a sus valores predeterminados.
+     *      memoria de la lista de adyacencia (adjOffsets, adjNeighbors y adjWeights) y de
+     *      los nodos (ips). Además, restablece los valores miembro a sus valores predeterminados.
      *
      * Parámetros de entrada:
      *      No posee parámetros de entrada.
@@ -116,7 +410,12 @@ public:
      * Descripción: readGraph()
      *      Método que lee la lista de adyacencia del grafo desde la apertura de
      *      un archivo y construye la representación del grafo en la memoria mediante
-     *      la estructura de datos adjList. A su vez, inicializa una Tabla Hash con un
+     *      una lista de adyacencia en formato CSR (adjOffsets, adjNeighbors y adjWeights).
+     *      Las direcciones de cada arista se resuelven con el diccionario ipIndex en O(1).
+     *      La sección de aristas se lee en bloques de tamaño fijo que se procesan en paralelo
+     *      (parseEdges), así que el texto no se carga completo en memoria, y los
+     *      grados de entrada y salida se obtienen de la lista de adyacencia ya construida.
+     *      A su vez, inicializa una Tabla Hash con un
      *      tamaño máximo, primo, mayor y cercano al numero de direcciones iP en la 
      *      bitácora de acuerdo con lo seleccionado con el usuario.
      *
@@ -129,7 +428,7 @@ public:
      *      @_weighted: Un entero que indica si el grafo es ponderado (1) o no ponderado (0).
      * 
      *      @option: Un int que representa la opción para determinar el tamaño máximo (MaxSize) 
-     *      de la tabla hash.
+     *      de la tabla hash; 0 indica tamaño automático (la tabla crece con su factor de carga).
      *
      * Valor de retorno:
      *      No retorna ningún valor.
@@ -143,9 +442,9 @@ public:
     /*
      * Descripción: getIPSummary()
      *     Método utilizado para un obtener un resumen de información relacionada con una dirección
-     *     IP específica en el grafo. La dirección IP se busca en el vector ips utilizando una
-     *     búsqueda binaria (binarySearch), y si se encuentra, se procede a obtener información
-     *     adicional relacionada con esa dirección IP dentro de la tabla hash.
+     *     IP específica en el grafo. La dirección IP se busca en el diccionario ipIndex, y si se
+     *     encuentra, se procede a obtener información adicional relacionada con esa dirección IP
+     *     dentro de la tabla hash. Cada vecino se resuelve con una lectura de posById.
      *
      * Parámetros de entrada:
      *      @searchedIp: Un string que representa la dirección IP que se desea obtener el resumen.
@@ -154,17 +453,36 @@ public:
      *      No retorna ningún valor.
      *
      * Complejidad temporal:
-     *      O(n log n)
+     *      O(g log g) donde g es el grado de salida del nodo (inserciones en el heap).
      */
 
     void getIPSummary(std::string searchedIp);
 
+    /*
+     * Descripción: getIPInSummary()
+     *     Método que muestra las direcciones IP que intentaron acceder a la dirección IP
+     *     recibida, ordenadas de mayor a menor. Recorre únicamente las aristas de entrada
+     *     del nodo en la lista de adyacencia inversa, sin revisar todas las aristas del grafo.
+     *
+     * Parámetros de entrada:
+     *      @searchedIp: Un string que representa la dirección IP destino.
+     *
+     * Valor de retorno:
+     *      No retorna ningún valor.
+     *
+     * Complejidad temporal:
+     *      O(g log g) donde g es el grado de entrada del nodo (inserciones en el heap).
+     */
+
+    void getIPInSummary(std::string searchedIp);
+
     /*
      * Descripción: getHashT()
      *      Método utilizado para construir una tabla hash (hashTableIp) a partir de las direcciones IP
-     *      almacenadas en el vector ips. Cada dirección IP se agrega a la tabla hash utilizando el método
+     *      almacenadas en ips. Cada dirección IP se agrega a la tabla hash utilizando el método
      *      add de la tabla hash, donde la dirección IP es la clave y el objeto ipAddress correspondiente es
-     *      el valor.
+     *      el valor. La celda de cada dirección se guarda en hashSlot para no repetir la búsqueda
+     *      en la tabla al consultar un resumen.
      *
      * Parámetros de entrada:
      *      No posee parámetros de entrada.
@@ -182,10 +500,92 @@ public:
     /*
      * Descripción: printCollisions()
      *      Método utilizado para imprimir el número total de colisiones que ocurren al generar una tabla 
-     *      hash de tamaño sizeHT utilizando la tabla hash hashTableIp.
+     *      hash de tamaño sizeHT utilizando la tabla hash hashTableIp. Si el grafo se cargó de un
+     *      snapshot se imprime el número de colisiones guardado en él. Con detailed también se
+     *      imprimen las estadísticas detalladas de la tabla (HashStats) si el motor las lleva.
      *
      * Parámetros de entrada:
-     *      No posee parámetros de entrada.
+     *      @detailed: true para imprimir también las estadísticas detalladas.
+     *
+     * Valor de retorno:
+     *      No retorna ningún valor.
+     *
+     * Complejidad temporal:
+     *      O(1), u O(n) con detailed.
+     */
+
+    void printCollisions(bool detailed = false);
+
+    /*
+     * Descripción: printHashPolicyReport()
+     *      Imprime, para cada combinación de función hash y política de tamaño de HashTable,
+     *      las colisiones y longitudes de sondeo que produce el conjunto de direcciones IP del
+     *      grafo con el tamaño de tabla elegido.
+     *
+     * Parámetros de entrada:
+     *      @detailed: true para imprimir también las estadísticas detalladas de cada política.
+     *
+     * Valor de retorno:
+     *      No retorna ningún valor.
+     *
+     * Complejidad temporal:
+     *      O(n) en promedio por política, donde n es el número de nodos.
+     */
+
+    void printHashPolicyReport(bool detailed = false);
+
+    /*
+     * Descripción: saveSnapshot()
+     *      Guarda el grafo construido (nodos, lista de adyacencia directa e inversa, índice de
+     *      direcciones y celdas de la tabla hash) en un snapshot que se puede mapear en memoria.
+     *      Debe invocarse después de readGraph() y getHashT().
+     *
+     * Parámetros de entrada:
+     *      @snapshotFile: nombre del archivo del snapshot.
+     *
+     *      @sourceFile: nombre de la bitácora de la que se construyó el grafo.
+     *
+     *      @option: opción de tamaño de la tabla hash con la que se construyó.
+     *
+     * Valor de retorno:
+     *      true si el snapshot se escribió, false en caso contrario.
+     *
+     * Complejidad temporal:
+     *      O(n + m) donde n es el número de nodos y m el número de aristas.
+     */
+
+    bool saveSnapshot(std::string snapshotFile, std::string sourceFile, int option);
+
+    /*
+     * Descripción: setCompressedAdjacency()
+     *      Activa o desactiva el modo de adyacencia comprimida para el siguiente readGraph().
+     *      En este modo, después de construir la lista CSR se codifican las aristas de salida
+     *      y de entrada con diferencias en varint y pesos de ancho reducido, y se liberan los
+     *      arreglos CSR. Los snapshots sólo se admiten sin compresión.
+     *
+     * Parámetros de entrada:
+     *      @enabled: true para activar la compresión.
+     *
+     * Valor de retorno:
+     *      No retorna ningún valor.
+     *
+     * Complejidad temporal:
+     *      O(1)
+     */
+
+    void setCompressedAdjacency(bool enabled);
+
+    /*
+     * Descripción: setAggregatedEdges()
+     *      Activa o desactiva el modo de aristas agregadas para el siguiente readGraph(). En
+     *      este modo las conexiones repetidas entre dos direcciones se fusionan en una sola
+     *      arista y los resúmenes muestran cada dirección vecina una vez, con el número de
+     *      conexiones, el peso total y la primera y última fecha. Los grados de cada nodo
+     *      siguen contando todas las conexiones de la bitácora. Los snapshots sólo se admiten
+     *      sin agregación.
+     *
+     * Parámetros de entrada:
+     *      @enabled: true para activar la agregación.
      *
      * Valor de retorno:
      *      No retorna ningún valor.
@@ -194,28 +594,126 @@ public:
      *      O(1)
      */
 
-    void printCollisions();
+    void setAggregatedEdges(bool enabled);
+
+    /*
+     * Descripción: loadSnapshot()
+     *      Mapea un snapshot en memoria y hace que las consultas lean directamente de él, sin
+     *      leer la bitácora ni reconstruir la tabla hash. El snapshot se descarta si no
+     *      corresponde al tamaño y fecha de la bitácora o a la opción de la tabla hash.
+     *
+     * Parámetros de entrada:
+     *      @snapshotFile: nombre del archivo del snapshot.
+     *
+     *      @sourceFile: nombre de la bitácora que representa.
+     *
+     *      @option: opción de tamaño de la tabla hash elegida por el usuario.
+     *
+     * Valor de retorno:
+     *      true si el snapshot se cargó, false si no existe o no es válido.
+     *
+     * Complejidad temporal:
+     *      O(1); las páginas del archivo se leen al consultarlas.
+     */
+
+    bool loadSnapshot(std::string snapshotFile, std::string sourceFile, int option);
+
+    /*
+     * Descripción: buildPerfectHash()
+     *      Construye un hash perfecto mínimo (PerfectHash) con las IP del grafo ya cargado, que
+     *      desde ese momento reemplaza a ipIndex al buscar la posición de una IP y a hashTableIp
+     *      en getIPSummary(): cada consulta lee un piloto y una casilla, sin sondeo, y el nodo
+     *      se arma desde view. El conjunto de IP es fijo después de readGraph() o
+     *      loadSnapshot(), así que la función no necesita inserciones ni borrados.
+     *
+     * Parámetros de entrada:
+     *      No posee parámetros de entrada.
+     *
+     * Valor de retorno:
+     *      No retorna ningún valor.
+     *
+     * Complejidad temporal:
+     *      O(n) en promedio, donde n es el número de nodos.
+     */
+
+    void buildPerfectHash();
+
+    /*
+     * Descripción: saveHashImage()
+     *      Escribe la imagen de hashTableIp (HashTableImage.h) para que las siguientes
+     *      ejecuciones la mapeen con loadHashImage() en lugar de llamar a getHashT(). Debe
+     *      invocarse después de getHashT(). Sólo la HashTable con una función hash sin llave
+     *      tiene imagen, y no se escribe con aristas agregadas.
+     *
+     * Parámetros de entrada:
+     *      @imageFile: nombre del archivo de la imagen.
+     *
+     *      @sourceFile: nombre de la bitácora de la que se construyó la tabla.
+     *
+     * Valor de retorno:
+     *      true si la imagen se escribió, false en caso contrario.
+     *
+     * Complejidad temporal:
+     *      O(n) donde n es el número de celdas de la tabla.
+     */
+
+    bool saveHashImage(std::string imageFile, std::string sourceFile);
+
+    /*
+     * Descripción: loadHashImage()
+     *      Reemplaza a getHashT(): mapea la imagen de la tabla hash y busca en ella la celda de
+     *      cada dirección. Desde ese momento los resúmenes y el número de colisiones se leen de
+     *      la imagen. La imagen se descarta si no corresponde al tamaño y fecha de la bitácora,
+     *      al tamaño de la tabla elegido en readGraph() o a las direcciones leídas.
+     *
+     * Parámetros de entrada:
+     *      @imageFile: nombre del archivo de la imagen.
+     *
+     *      @sourceFile: nombre de la bitácora que representa.
+     *
+     * Valor de retorno:
+     *      true si la imagen se cargó, false si no existe o no es válida.
+     *
+     * Complejidad temporal:
+     *      O(n) búsquedas en la imagen, repartidas entre los hilos, sin reservar la tabla.
+     */
+
+    bool loadHashImage(std::string imageFile, std::string sourceFile);
 };
 
-template <class T>
-Graph<T>::Graph(){
+template <class Table>
+Graph<Table>::Graph(){
     numNodes = 0;
     numEdges = 0;
     directedGraph = 1;
     weightedGraph = 1;
+    compressed = false;
+    aggregated = false;
 }
 
-template <class T>
-Graph<T>::~Graph(){
-    adjList.clear();
+template <class Table>
+Graph<Table>::~Graph(){
+    adjOffsets.clear();
+    adjNeighbors.clear();
+    adjWeights.clear();
+    inOffsets.clear();
+    inNeighbors.clear();
+    inWeights.clear();
+    ips.clear();
+    compressedOut.clear();
+    compressedIn.clear();
+    pairHits.clear();
+    pairFirstSeen.clear();
+    pairLastSeen.clear();
+    inPairIds.clear();
     numNodes = 0;
     numEdges = 0;
     directedGraph = 1;
     weightedGraph = 1;
 }
 
-template <class T>
-void Graph<T>::split(std::string line, std::vector<int> &res){
+template <class Table>
+void Graph<Table>::split(std::string line, std::vector<int> &res){
     size_t strPos = line.find(" ");
     size_t lastPos = 0;
 
@@ -228,38 +726,523 @@ void Graph<T>::split(std::string line, std::vector<int> &res){
     res.push_back(stoi(line.substr(lastPos, line.size() - lastPos)));
 }
 
-template <class T>
-int Graph<T>::binarySearch(ipAddress key){
-    int low = 0;
-    int high = ips.size() - 1;
-    int mid = 0;
+template <class Table>
+int Graph<Table>::binarySearch(ipAddress key){
+    return ips.find(key.getIpValue());
+}
+
+template <class Table>
+int Graph<Table>::findPosition(const std::string &searchedIp){
+    std::uint32_t value = 0;
+    IpParseError error = ipAddress::parse(searchedIp, value);
+
+    if (error != IpParseError::None){
+        throw std::invalid_argument("Direccion IP no valida (" + std::string(ipAddress::parseErrorMessage(error)) + ").");
+    }
+
+    if (ipPerfect.size() > 0){
+        int pos = perfectPos[ipPerfect.find(value)];
+        return (view.ipValues[pos] == value) ? pos : -1;
+    }
+
+    return IpIndexMap::findIn(view.indexKeys, view.indexValues, view.indexCapacity, view.indexShift, value);
+}
+
+template <class Table>
+void Graph<Table>::refreshView(){
+    view.numNodes = numNodes;
+    view.numEdges = (int)adjNeighbors.size();
+    view.ipValues = ips.getIpValueData();
+    view.nodeIds = ips.getNodeIdData();
+    view.degreeIn = ips.getDegreeInData();
+    view.degreeOut = ips.getDegreeOutData();
+    view.stringOffsets = ips.getStringOffsetData();
+    view.strings = ips.getStringData();
+    view.posById = posById.data();
+    view.hashSlot = hashSlot.empty() ? nullptr : hashSlot.data();
+    view.adjOffsets = adjOffsets.data();
+    view.adjNeighbors = adjNeighbors.data();
+    view.adjWeights = adjWeights.data();
+    view.inOffsets = inOffsets.data();
+    view.inNeighbors = inNeighbors.data();
+    view.inWeights = inWeights.data();
+    view.indexKeys = ipIndex.getKeyData();
+    view.indexValues = ipIndex.getValueData();
+    view.indexCapacity = ipIndex.getCapacity();
+    view.indexShift = ipIndex.getShift();
+}
+
+template <class Table>
+ipAddress Graph<Table>::materializeNode(int pos){
+    std::uint32_t begin = view.stringOffsets[pos];
+    ipAddress address(std::string(view.strings + begin, view.stringOffsets[pos + 1] - begin), view.nodeIds[pos]);
+    address.setDegreeIn(view.degreeIn[pos]);
+    address.setDegreeOut(view.degreeOut[pos]);
+    return address;
+}
 
-    while (low <= high){
-        mid = low + (high - low) / 2;
+template <class Table>
+template <class Visitor>
+void Graph<Table>::forEachOutNeighbor(int u, Visitor visit){
 
-        if (key == ips[mid]){
-            return mid;
+    if (compressed){
+        compressedOut.forEach(u, visit);
+        return;
+    }
+
+    for (int e = view.adjOffsets[u]; e < view.adjOffsets[u + 1]; e++){
+        visit(view.adjNeighbors[e], view.adjWeights[e], e);
+    }
+}
+
+template <class Table>
+template <class Visitor>
+void Graph<Table>::forEachInNeighbor(int u, Visitor visit){
+
+    if (compressed){
+        compressedIn.forEach(u, visit);
+        return;
+    }
+
+    for (int e = view.inOffsets[u]; e < view.inOffsets[u + 1]; e++){
+        visit(view.inNeighbors[e], view.inWeights[e], e);
+    }
+}
+
+template <class Table>
+void Graph<Table>::setCompressedAdjacency(bool enabled){
+    compressed = enabled;
+}
+
+template <class Table>
+void Graph<Table>::setAggregatedEdges(bool enabled){
+    aggregated = enabled;
+}
+
+template <class Table>
+template <class Item>
+void Graph<Table>::printSortedPeers(MaxHeap<Item> &peers){
+    int i = 1;
+
+    while (!peers.isEmpty()){
+        std::cout << i << ".\t|\t  " << peers.getTop() << "\t\t\t     |" << std::endl;
+        peers.pop();
+        i++;
+    }
+}
+
+template <class Table>
+void Graph<Table>::summarizePeers(int u, bool outgoing){
+    // Las listas agregadas no tienen vecinos repetidos y están ordenadas por vecino, así que
+    // la posición que entrega el recorrido es la misma con o sin compresión.
+    int entries = outgoing ? (compressed ? compressedOut.degree(u) : view.adjOffsets[u + 1] - view.adjOffsets[u])
+                           : (compressed ? compressedIn.degree(u) : view.inOffsets[u + 1] - view.inOffsets[u]);
+    MaxHeap<PeerSummary> peers(entries);
+    auto collect = [this, outgoing, &peers](int neighborId, int weight, int slot){
+        int pairId = outgoing ? slot : inPairIds[slot];
+        PeerSummary peer;
+        peer.address = materializeNode(view.posById[neighborId]);
+        peer.address.showAccessedIp = true;
+        peer.hits = pairHits[pairId];
+        peer.totalWeight = weight;
+        peer.firstSeen = pairFirstSeen[pairId];
+        peer.lastSeen = pairLastSeen[pairId];
+        peers.push(peer);
+    };
+
+    if (outgoing){
+        forEachOutNeighbor(u, collect);
+    }
+
+    else{
+        forEachInNeighbor(u, collect);
+    }
+
+    printSortedPeers(peers);
+}
+
+template <class Table>
+bool Graph<Table>::saveSnapshot(std::string snapshotFile, std::string sourceFile, int option){
+    TraceScope traceSave("Graph::saveSnapshot");
+    SnapshotHeader meta;
+    std::memset(&meta, 0, sizeof(meta));
+
+    if (compressed || aggregated || view.hashSlot == nullptr || !GraphSnapshot::sourceStamp(sourceFile, meta.sourceSize, meta.sourceTime)){
+        return false;
+    }
+
+    meta.option = option;
+    meta.sizeHT = sizeHT;
+    meta.numCollisions = hashTableIp.getNumCollisions();
+    return GraphSnapshot::write(snapshotFile, meta, view);
+}
+
+template <class Table>
+bool Graph<Table>::loadSnapshot(std::string snapshotFile, std::string sourceFile, int option){
+    TraceScope traceLoad("Graph::loadSnapshot");
+    std::uint64_t sourceSize = 0;
+    std::int64_t sourceTime = 0;
+
+    if (!GraphSnapshot::sourceStamp(sourceFile, sourceSize, sourceTime) || !snapshot.open(snapshotFile)){
+        return false;
+    }
+
+    const SnapshotHeader &header = snapshot.getHeader();
+
+    if (header.sourceSize != sourceSize || header.sourceTime != sourceTime || header.option != option){
+        snapshot.close();
+        return false;
+    }
+
+    view = snapshot.getView();
+    numNodes = view.numNodes;
+    numEdges = view.numEdges;
+    sizeHT = header.sizeHT;
+    MemoryTracker::getInstance().setNumRecords(numEdges);
+    return true;
+}
+
+template <class Table>
+bool Graph<Table>::saveHashImage(std::string imageFile, std::string sourceFile){
+    TraceScope traceSave("Graph::saveHashImage");
+    HashImageHeader meta;
+    std::memset(&meta, 0, sizeof(meta));
+
+    if (aggregated || hashImage.isOpen() || !GraphSnapshot::sourceStamp(sourceFile, meta.sourceSize, meta.sourceTime)){
+        return false;
+    }
+
+    return writeHashImage(hashTableIp, imageFile, meta);
+}
+
+template <class Table>
+bool Graph<Table>::loadHashImage(std::string imageFile, std::string sourceFile){
+    TraceScope traceLoad("Graph::loadHashImage");
+    std::uint64_t sourceSize = 0;
+    std::int64_t sourceTime = 0;
+
+    if (aggregated || !GraphSnapshot::sourceStamp(sourceFile, sourceSize, sourceTime) || !hashImage.open(imageFile)){
+        return false;
+    }
+
+    const HashImageHeader &header = hashImage.getHeader();
+
+    if (header.sourceSize != sourceSize || header.sourceTime != sourceTime || hashImage.getCapacity() != hashTableIp.getCapacity() || hashImage.getNumElements() != numNodes){
+        hashImage.close();
+        return false;
+    }
+
+    hashSlot.assign(numNodes, -1);
+    std::atomic<bool> missing(false);
+
+    parallelFor(0, numNodes, 4096, [this, &missing](int begin, int end){
+
+        for (int i = begin; i < end; i++){
+            hashSlot[i] = hashImage.find(ips.getIpValue(i));
+
+            if (hashSlot[i] == -1){
+                missing = true;
+            }
+        }
+    });
+
+    if (missing){
+        hashImage.close();
+        return false;
+    }
+
+    sizeHT = hashImage.getCapacity();
+    refreshView();
+    return true;
+}
+
+template <class Table>
+bool Graph<Table>::parseEdgeLine(std::string_view line, unsigned int &valueU, unsigned int &valueV, int &weight, int &timestamp){
+    const char *p = line.data();
+    const char *end = p + line.size();
+    unsigned int *values[2] = {&valueU, &valueV};
+    std::string_view date[3];
+
+    // Tokens de la fecha: mes, día y hora.
+    for (int token = 0; token < 3; token++){
+
+        while (p < end && *p == ' '){
+            p++;
         }
 
-        else if (key < ips[mid]){
-            high = mid - 1;
+        const char *start = p;
+
+        while (p < end && *p != ' '){
+            p++;
         }
 
-        else{
-            low = mid + 1;
+        date[token] = std::string_view(start, (std::size_t)(p - start));
+    }
+
+    timestamp = parseLogTime(date[0], date[1], date[2]);
+
+    for (int k = 0; k < 2; k++){
+
+        while (p < end && *p == ' '){
+            p++;
+        }
+
+        const char *start = p;
+
+        while (p < end && *p != ':' && *p != ' '){
+            p++;
+        }
+
+        std::uint32_t value = 0;
+
+        if (p >= end || *p != ':' || ipAddress::parse(std::string_view(start, (std::size_t)(p - start)), value) != IpParseError::None){
+            return false;
         }
+
+        *values[k] = value;
+
+        while (p < end && *p != ' '){
+            p++;
+        }
+    }
+
+    while (p < end && *p == ' '){
+        p++;
+    }
+
+    bool negative = (p < end && *p == '-');
+    p += negative ? 1 : 0;
+
+    if (p >= end || *p < '0' || *p > '9'){
+        return false;
     }
 
-    return -1;
+    // Igual que std::stoi, un peso fuera del rango de int invalida la línea.
+    long long limit = negative ? 2147483648LL : 2147483647LL;
+    long long number = 0;
+
+    while (p < end && *p >= '0' && *p <= '9'){
+        number = number * 10 + (*p - '0');
+        p++;
+
+        if (number > limit){
+            return false;
+        }
+    }
+
+    weight = (int)(negative ? -number : number);
+    return true;
 }
 
-template <class T>
-void Graph<T>::readGraph(std::string inputFile, int _directed, int _weighted, int option){
+template <class Table>
+void Graph<Table>::parseEdges(std::string_view text, EdgeBuffer &edges){
+    ThreadPool &pool = ThreadPool::getInstance();
+    int numChunks = (pool.getNumThreads() <= 1) ? 1 : pool.getNumThreads() * 4;
+    std::vector<std::size_t> bounds(numChunks + 1, text.size());
+    bounds[0] = 0;
+
+    for (int c = 1; c < numChunks; c++){
+        std::size_t start = std::max(bounds[c - 1], text.size() / numChunks * c);
+        std::size_t newline = text.find('\n', start);
+        bounds[c] = (newline == std::string_view::npos) ? text.size() : newline + 1;
+    }
+
+    std::vector<EdgeBuffer> chunkEdges(numChunks);
+    TaskGroup group(pool);
+
+    for (int c = 0; c < numChunks; c++){
+        group.run([this, c, text, &bounds, &chunkEdges](){
+            std::string_view chunk = text.substr(bounds[c], bounds[c + 1] - bounds[c]);
+            EdgeBuffer &out = chunkEdges[c];
+            out.reserve(chunk.size() / 48 + 1);
+
+            while (!chunk.empty()){
+                std::size_t newline = chunk.find('\n');
+                std::string_view line = chunk.substr(0, newline);
+                chunk.remove_prefix(newline == std::string_view::npos ? chunk.size() : newline + 1);
+
+                if (line.find_first_not_of(" \t\r") == std::string_view::npos){
+                    continue;
+                }
+
+                unsigned int valueU = 0;
+                unsigned int valueV = 0;
+                int weight = 0;
+                int timestamp = -1;
+
+                if (!parseEdgeLine(line, valueU, valueV, weight, timestamp)){
+                    throw std::invalid_argument("Linea de arista invalida: " + std::string(line));
+                }
+
+                int pos1 = ipIndex.find(valueU);
+                int pos2 = ipIndex.find(valueV);
+
+                if (pos1 == -1 || pos2 == -1){
+                    throw std::invalid_argument("Direccion IP de arista no encontrada: " + std::string(line));
+                }
+
+                out.push_back({ips.getNodeId(pos1), ips.getNodeId(pos2), weight, timestamp});
+            }
+        });
+    }
+
+    group.wait();
+
+    std::size_t total = 0;
+
+    for (const EdgeBuffer &chunk : chunkEdges){
+        total += chunk.size();
+    }
+
+    edges.reserve(edges.size() + total);
+
+    for (EdgeBuffer &chunk : chunkEdges){
+        edges.insert(edges.end(), chunk.begin(), chunk.end());
+        EdgeBuffer().swap(chunk);
+    }
+}
+
+template <class Table>
+void Graph<Table>::buildAdjacency(const EdgeBuffer &edges){
+    int totalEdges = (int)edges.size();
+    adjOffsets.assign(numNodes + 1, 0);
+    adjNeighbors.resize(totalEdges);
+    adjWeights.resize(totalEdges);
+    inOffsets.assign(numNodes + 1, 0);
+    inNeighbors.resize(totalEdges);
+    inWeights.resize(totalEdges);
+    ThreadPool &pool = ThreadPool::getInstance();
+
+    if (pool.getNumThreads() <= 1){
+
+        for (const Edge &edge : edges){
+            adjOffsets[edge.source + 1]++;
+            inOffsets[edge.target + 1]++;
+        }
+
+        for (int u = 0; u < numNodes; u++){
+            adjOffsets[u + 1] += adjOffsets[u];
+            inOffsets[u + 1] += inOffsets[u];
+        }
+
+        std::vector<int> nextSlot(adjOffsets.begin(), adjOffsets.end() - 1);
+        std::vector<int> nextInSlot(inOffsets.begin(), inOffsets.end() - 1);
+
+        for (const Edge &edge : edges){
+            int slot = nextSlot[edge.source]++;
+            adjNeighbors[slot] = edge.target;
+            adjWeights[slot] = edge.weight;
+
+            int inSlot = nextInSlot[edge.target]++;
+            inNeighbors[inSlot] = edge.source;
+            inWeights[inSlot] = edge.weight;
+        }
+
+        return;
+    }
+
+    std::vector<std::atomic<int>> outCount(numNodes);
+    std::vector<std::atomic<int>> inCount(numNodes);
+
+    parallelFor(0, totalEdges, 65536, [&edges, &outCount, &inCount](int begin, int end){
+
+        for (int k = begin; k < end; k++){
+            outCount[edges[k].source].fetch_add(1, std::memory_order_relaxed);
+            inCount[edges[k].target].fetch_add(1, std::memory_order_relaxed);
+        }
+    }, pool);
+
+    // Los contadores se reutilizan como la siguiente casilla libre de cada nodo.
+    for (int u = 0; u < numNodes; u++){
+        adjOffsets[u + 1] = adjOffsets[u] + outCount[u].load(std::memory_order_relaxed);
+        inOffsets[u + 1] = inOffsets[u] + inCount[u].load(std::memory_order_relaxed);
+        outCount[u].store(adjOffsets[u], std::memory_order_relaxed);
+        inCount[u].store(inOffsets[u], std::memory_order_relaxed);
+    }
+
+    std::vector<int> outOrder(totalEdges);
+    std::vector<int> inOrder(totalEdges);
+
+    parallelFor(0, totalEdges, 65536, [&edges, &outCount, &inCount, &outOrder, &inOrder](int begin, int end){
+
+        for (int k = begin; k < end; k++){
+            outOrder[outCount[edges[k].source].fetch_add(1, std::memory_order_relaxed)] = k;
+            inOrder[inCount[edges[k].target].fetch_add(1, std::memory_order_relaxed)] = k;
+        }
+    }, pool);
+
+    parallelFor(0, numNodes, 4096, [this, &outOrder, &inOrder](int begin, int end){
+
+        for (int u = begin; u < end; u++){
+            std::sort(outOrder.begin() + adjOffsets[u], outOrder.begin() + adjOffsets[u + 1]);
+            std::sort(inOrder.begin() + inOffsets[u], inOrder.begin() + inOffsets[u + 1]);
+        }
+    }, pool);
+
+    parallelFor(0, totalEdges, 65536, [this, &edges, &outOrder, &inOrder](int begin, int end){
+
+        for (int slot = begin; slot < end; slot++){
+            adjNeighbors[slot] = edges[outOrder[slot]].target;
+            adjWeights[slot] = edges[outOrder[slot]].weight;
+            inNeighbors[slot] = edges[inOrder[slot]].source;
+            inWeights[slot] = edges[inOrder[slot]].weight;
+        }
+    }, pool);
+}
+
+template <class Table>
+void Graph<Table>::aggregateEdges(EdgeBuffer &edges){
+    std::sort(edges.begin(), edges.end(), [](const Edge &a, const Edge &b){
+        return a.source < b.source || (a.source == b.source && a.target < b.target);
+    });
+
+    pairHits.clear();
+    pairFirstSeen.clear();
+    pairLastSeen.clear();
+    std::size_t numPairs = 0;
+    long long totalWeight = 0;
+
+    for (std::size_t k = 0; k < edges.size(); k++){
+        const Edge edge = edges[k];
+
+        if (numPairs == 0 || edges[numPairs - 1].source != edge.source || edges[numPairs - 1].target != edge.target){
+            edges[numPairs++] = edge;
+            pairHits.push_back(1);
+            pairFirstSeen.push_back(edge.timestamp);
+            pairLastSeen.push_back(edge.timestamp);
+            totalWeight = edge.weight;
+            continue;
+        }
+
+        std::size_t pair = numPairs - 1;
+        totalWeight += edge.weight;
+        edges[pair].weight = (int)std::max<long long>(std::min<long long>(totalWeight, 2147483647LL), -2147483647LL - 1);
+        pairHits[pair]++;
+
+        // Las fechas no válidas (-1) no cuentan como primera ni última conexión.
+        if (edge.timestamp != -1 && (pairFirstSeen[pair] == -1 || edge.timestamp < pairFirstSeen[pair])){
+            pairFirstSeen[pair] = edge.timestamp;
+        }
+
+        if (edge.timestamp > pairLastSeen[pair]){
+            pairLastSeen[pair] = edge.timestamp;
+        }
+    }
+
+    edges.resize(numPairs);
+}
+
+template <class Table>
+void Graph<Table>::readGraph(std::string inputFile, int _directed, int _weighted, int option){
     directedGraph = _directed;
     weightedGraph = _weighted;
-    std::string line, ip1, ip2, peso;
-    int i = 0;
-    std::ifstream file(inputFile);
+    std::string line;
+    std::vector<std::string> nodeLines;
+    EdgeBuffer edges;
+    std::ifstream file(inputFile, std::ios::binary);
+    TraceScope traceReadGraph("Graph::readGraph");
+    PerfScope perfReadGraph("Graph::readGraph");
+    Tracer &tracer = Tracer::getInstance();
 
     if (!file.good()){
         file.close();
@@ -267,138 +1250,291 @@ void Graph<T>::readGraph(std::string inputFile, int _directed, int _weighted, in
     }
 
     else{
-        while (std::getline(file, line)){
-
-            if (i == 0){
-                std::vector<int> res;
-                split(line, res);
-                numNodes = res[0];
-                numEdges = res[1];
-
-                adjList.resize(numNodes);
-                Numbers getSizes;
-                vecSizeHash = getSizes.findClosePrime(numNodes);
-                sizeHT = vecSizeHash[option-1];
-                hashTableIp.setMaxSize(sizeHT);
-                i++;
-                continue;
+
+        if (!std::getline(file, line)){
+            throw std::invalid_argument("Archivo vacio");
+        }
+
+        std::vector<int> res;
+        split(line, res);
+        numNodes = res[0];
+        numEdges = res[1];
+        MemoryTracker::getInstance().setNumRecords(numEdges);
+
+        Numbers getSizes;
+        vecSizeHash = getSizes.findClosePrime(numNodes);
+
+        // La opción 0 deja que la tabla hash crezca según el número de direcciones.
+        if (option == 0){
+            hashTableIp.setAutomaticSize(numNodes);
+        }
+
+        else{
+            hashTableIp.setMaxSize(vecSizeHash[option-1]);
+        }
+
+        sizeHT = hashTableIp.getCapacity();
+
+        tracer.begin("readGraph: nodos");
+        nodeLines.reserve(numNodes);
+
+        while ((int)nodeLines.size() < numNodes && std::getline(file, line)){
+            nodeLines.push_back(line);
+        }
+
+        if ((int)nodeLines.size() < numNodes){
+            throw std::invalid_argument("La bitacora tiene menos nodos de los indicados.");
+        }
+
+        tracer.end("readGraph: nodos");
+        tracer.begin("readGraph: ordenar ips");
+        ips.build(nodeLines);
+        std::vector<std::string>().swap(nodeLines);
+        tracer.end("readGraph: ordenar ips");
+
+        ipIndex.reserve(numNodes);
+        posById.assign(numNodes, -1);
+
+        for (int k = 0; k < numNodes; k++){
+            ipIndex.insert(ips.getIpValue(k), k);
+            posById[ips.getNodeId(k)] = k;
+        }
+
+        // La sección de aristas se lee en bloques de EDGE_BLOCK_BYTES que terminan en un salto
+        // de línea y cada bloque se procesa en paralelo; el texto ocupa un solo bloque sin
+        // importar el tamaño de la bitácora. La línea incompleta al final de un bloque pasa al
+        // inicio del siguiente, y si una línea no cabe en el bloque, el bloque crece.
+        tracer.begin("readGraph: aristas");
+        edges.reserve(numEdges > 0 ? numEdges : 0);
+        std::vector<char, TrackingAllocator<char, MemoryTag::Records>> block(EDGE_BLOCK_BYTES);
+        std::size_t carried = 0;
+
+        while (true){
+            file.read(block.data() + carried, (std::streamsize)(block.size() - carried));
+            std::size_t filled = carried + (std::size_t)file.gcount();
+            bool last = !file;
+
+            if (filled == 0){
+                break;
             }
 
-            else if (i > 0 && i <= numNodes){
-                T data = line;
-                nodesInfo.insert(std::make_pair(i - 1, data));
-                ipAddress tmpIP(line, i - 1);
-                ips.push_back(tmpIP);
+            std::size_t cut = filled;
 
-                if (i == numNodes){
-                    std::sort(ips.begin(), ips.end());
+            if (!last){
+                std::string_view text(block.data(), filled);
+                std::size_t newline = text.rfind('\n');
+
+                if (newline == std::string_view::npos){
+                    carried = filled;
+                    block.resize(2 * block.size());
+                    continue;
                 }
 
-                i++;
-                continue;
+                cut = newline + 1;
             }
 
-            std::size_t found = line.find(":", 15);
-            ip1 = line.substr(15, found - 15);
+            parseEdges(std::string_view(block.data(), cut), edges);
+            carried = filled - cut;
+            std::memmove(block.data(), block.data() + cut, carried);
+
+            if (last){
+                break;
+            }
+        }
 
-            std::size_t found2 = line.find(" ", found + 1);
-            std::size_t found3 = line.find(":", found2 + 1);
-            ip2 = line.substr(found2, found3 - found2);
+        file.close();
+        decltype(block)().swap(block);
+        tracer.end("readGraph: aristas");
+
+        // Con aristas agregadas los grados se cuentan antes de fusionar las conexiones
+        // repetidas, para que sigan reflejando todas las líneas de la bitácora.
+        std::vector<int> rawDegreeOut;
+        std::vector<int> rawDegreeIn;
+
+        if (aggregated){
+            tracer.begin("readGraph: agregar");
+            rawDegreeOut.assign(numNodes, 0);
+            rawDegreeIn.assign(numNodes, 0);
+
+            for (const Edge &edge : edges){
+                rawDegreeOut[edge.source]++;
+                rawDegreeIn[edge.target]++;
+            }
 
-            std::size_t found4 = line.find(" ", found3 + 1);
-            std::size_t found5 = line.find(" ", found4 + 1);
-            peso = line.substr(found4, found5 - found4);
+            aggregateEdges(edges);
+            tracer.end("readGraph: agregar");
+        }
 
-            int pos1 = binarySearch(ipAddress(ip1, 0)); 
-            int nodoU = ips[pos1].getIpIndex(); 
+        tracer.begin("readGraph: CSR");
+        buildAdjacency(edges);
 
-            int pos2 = binarySearch(ipAddress(ip2, 0));
-            int nodoV = ips[pos2].getIpIndex();
+        if (aggregated){
+            // Las aristas agregadas ya están ordenadas por origen, así que la arista k ocupa la
+            // posición k de la lista de salida; falta ubicarla en la lista inversa.
+            std::vector<int> nextInSlot(inOffsets.begin(), inOffsets.end() - 1);
+            inPairIds.assign(edges.size(), 0);
 
-            int weight = std::stoi(peso);
+            for (int k = 0; k < (int)edges.size(); k++){
+                inPairIds[nextInSlot[edges[k].target]++] = k;
+            }
+        }
 
-            adjList[nodoU].addLast(std::make_pair(nodoV, weight));
+        EdgeBuffer().swap(edges);
+        tracer.end("readGraph: CSR");
 
-            ips[pos1].addToDegreeOut();
-            ips[pos2].addToDegreeIn();
-           
-            i++;
+        // Los grados se obtienen de los desplazamientos de la lista de adyacencia.
+        parallelFor(0, numNodes, 4096, [this, &rawDegreeOut, &rawDegreeIn](int begin, int end){
+
+            for (int pos = begin; pos < end; pos++){
+                int id = ips.getNodeId(pos);
+
+                if (aggregated){
+                    ips.setDegrees(pos, rawDegreeIn[id], rawDegreeOut[id]);
+                }
+
+                else{
+                    ips.setDegrees(pos, inOffsets[id + 1] - inOffsets[id], adjOffsets[id + 1] - adjOffsets[id]);
+                }
+            }
+        });
+
+        if (compressed){
+            tracer.begin("readGraph: comprimir");
+            // Cada dirección se libera en cuanto se comprime para no tener ambas copias completas.
+            compressedOut.build(numNodes, adjOffsets.data(), adjNeighbors.data(), adjWeights.data());
+            decltype(adjOffsets)().swap(adjOffsets);
+            decltype(adjNeighbors)().swap(adjNeighbors);
+            decltype(adjWeights)().swap(adjWeights);
+            compressedIn.build(numNodes, inOffsets.data(), inNeighbors.data(), inWeights.data());
+            decltype(inOffsets)().swap(inOffsets);
+            decltype(inNeighbors)().swap(inNeighbors);
+            decltype(inWeights)().swap(inWeights);
+            tracer.end("readGraph: comprimir");
         }
 
-        file.close();
+        refreshView();
     }
 }
 
-template <class T>
-void Graph<T>::getHashT(){
+template <class Table>
+void Graph<Table>::getHashT(){
+    TraceScope traceHashT("Graph::getHashT");
+    PerfScope perfHashT("Graph::getHashT (HashTable::add/find)");
 
-    for (int i = 0; i < numNodes; i++){
-        hashTableIp.add(ips[i].getIpValue(), ips[i]);
-    }
+    hashSlot.assign(numNodes, -1);
+
+    insertAll(hashTableIp, numNodes, [this](int i){ return ips.getIpValue(i); }, [this](int i){ return ips.materialize(i); });
+
+    // Las celdas se leen al terminar de insertar: si la tabla crece durante las inserciones,
+    // las celdas obtenidas antes dejan de ser válidas. Las búsquedas sólo leen la tabla, así
+    // que se reparten entre los hilos.
+    parallelFor(0, numNodes, 4096, [this](int begin, int end){
+
+        for (int i = begin; i < end; i++){
+            hashSlot[i] = hashTableIp.find(ips.getIpValue(i));
+        }
+    });
+
+    sizeHT = hashTableIp.getCapacity();
+    refreshView();
 }
 
-template <class T>
-void Graph<T>::printCollisions(){
+template <class Table>
+void Graph<Table>::printCollisions(bool detailed){
+    TraceScope tracePrint("Graph::printCollisions");
     std::cout << "-+----------------------------------------------------------+-" << std::endl;
     std::cout << "Colisiones totales al generar una Tabla Hash de tamaño " << sizeHT << " |\n";
     std::cout << "-+----------------------------------------------------------+-" << std::endl;
-    std::cout << "COLISIONES     |\t\t       " << hashTableIp.getNumCollisions() << "\t\t     |" << std::endl;
+    int collisions = snapshot.isOpen() ? snapshot.getHeader().numCollisions : hashImage.isOpen() ? hashImage.getNumCollisions() : hashTableIp.getNumCollisions();
+    std::cout << "COLISIONES     |\t\t       " << collisions << "\t\t     |" << std::endl;
     std::cout << "-+----------------------------------------------------------+-" << std::endl;
+
+    if (detailed){
+        HashStats stats;
+
+        if (!snapshot.isOpen() && !hashImage.isOpen() && getHashStats(hashTableIp, stats)){
+            stats.print(std::cout);
+        }
+
+        else{
+            std::cout << "Estadisticas detalladas no disponibles para esta tabla." << std::endl;
+        }
+
+        std::cout << "-+----------------------------------------------------------+-" << std::endl;
+    }
+
+    if (ipPerfect.size() > 0){
+        std::cout << "HASH PERFECTO  |\t       " << std::fixed << std::setprecision(2) << ipPerfect.getBitsPerKey() << std::defaultfloat << " bits por IP\t     |" << std::endl;
+        std::cout << "-+----------------------------------------------------------+-" << std::endl;
+    }
+}
+
+template <class Table>
+void Graph<Table>::buildPerfectHash(){
+    TraceScope traceBuild("Graph::buildPerfectHash");
+    PerfScope perfBuild("Graph::buildPerfectHash");
+    ipPerfect.build(view.ipValues, numNodes);
+    perfectPos.assign(numNodes, -1);
+
+    for (int k = 0; k < numNodes; k++){
+        perfectPos[ipPerfect.find(view.ipValues[k])] = k;
+    }
+}
+
+template <class Table>
+void Graph<Table>::printHashPolicyReport(bool detailed){
+    TraceScope traceReport("Graph::printHashPolicyReport");
+    ::printHashPolicyReport(view.ipValues, numNodes, sizeHT, std::cout, detailed);
 }
 
-template <class T>
-void Graph<T>::getIPSummary(std::string searchedIp){
-    
-    int indexIp= binarySearch(ipAddress(searchedIp, 0)); //buscar indice del ip en ips
+template <class Table>
+void Graph<Table>::getIPSummary(std::string searchedIp){
+    TraceScope traceSummary([&searchedIp](){ return "Graph::getIPSummary " + searchedIp; });
+
+    int indexIp = findPosition(searchedIp); //buscar indice del ip en ips
 
     if (indexIp != -1){
-        int nodoU = ips[indexIp].getIpIndex(); // obtener indice real en bitacora
-        MaxHeap<ipAddress> accessedIpSort(ips[indexIp].getDegreeOut());
-        int indexHashT = hashTableIp.find(ips[indexIp].getIpValue()); // indice en el hash
+        int nodoU = view.nodeIds[indexIp]; // obtener indice real en bitacora
+        int indexHashT = (view.hashSlot != nullptr) ? view.hashSlot[indexIp] : -1; // indice en el hash
+        // Con un snapshot no se reconstruye la tabla hash y con el hash perfecto no se consulta;
+        // en ambos casos el nodo se arma desde view.
+        bool fromView = snapshot.isOpen() || ipPerfect.size() > 0;
         
-        if (indexHashT != -1){
+        if (indexHashT != -1 || fromView){
             
             std::cout << "-+----------------------------------------------------------+-" << std::endl;
             std::cout << "|          Resumen de la informacion relativa al IP:         |" << std::endl;
             std::cout << "-+----------------------------------------------------------+-" << std::endl;
-            std::cout << hashTableIp.getDataAt(indexHashT) << std::endl;
+            std::cout << (fromView ? materializeNode(indexIp) : hashImage.isOpen() ? hashImage.getDataAt(indexHashT) : hashTableIp.getDataAt(indexHashT)) << std::endl;
             std::cout << "-+----------------------------------------------------------+-\n" << std::endl;
            
 
-            NodeLinkedList<std::pair<int, int>> *p = adjList[nodoU].getHead();
-
-            while (p != nullptr){
-                int indexNodoV = p->data.first; //indice bitacora
-                auto it = nodesInfo.find(indexNodoV); //buscar ip de indice de la bitacora
-
-                if (it != nodesInfo.end()){
-                    int realIndex = binarySearch(ipAddress(it->second, 0)); //obtener su indice en ips
-
-                    if(realIndex != -1){
-                        ips[realIndex].showAccessedIp = true;
-                        accessedIpSort.push(ips[realIndex]);
-                        p = p->next;
-                    }
+            if (aggregated){
+                std::cout << "\n-+----------------------------------------------------------+-" << std::endl;
+                std::cout << "|  Lista de direcciones accesadas desde la IP recibida:      |" << std::endl;
+                std::cout << "-+----------------------------------------------------------+-" << std::endl;
+                summarizePeers(nodoU, true);
+                std::cout << "-+----------------------------------------------------------+-\n" << std::endl;
+                return;
+            }
 
-                    else{
-                        throw std::invalid_argument("Direccion IP no encontrada.");
-                    }
-                }
+            MaxHeap<ipAddress> accessedIpSort(view.degreeOut[indexIp]);
 
-                else{
-                    throw std::invalid_argument("Direccion IP no encontrada.");
-                }
+            {
+                PerfScope perfNeighbors("getIPSummary: vecinos");
+                forEachOutNeighbor(nodoU, [this, &accessedIpSort](int indexNodoV, int, int){
+                    int realIndex = view.posById[indexNodoV]; //indice en ips del vecino
+                    ipAddress neighbor = materializeNode(realIndex);
+                    neighbor.showAccessedIp = true;
+                    accessedIpSort.push(neighbor);
+                });
             }
 
+            TraceScope traceOutput("getIPSummary: salida");
             std::cout << "\n-+----------------------------------------------------------+-" << std::endl;
             std::cout << "|  Lista de direcciones accesadas desde la IP recibida:      |" << std::endl;
             std::cout << "-+----------------------------------------------------------+-" << std::endl;   
-            int i = 1;
-            while(!accessedIpSort.isEmpty()){
-                std::cout << i << ".\t|\t  " << accessedIpSort.getTop() << "\t\t\t     |" << std::endl;
-                accessedIpSort.pop();
-                i++;
-            }
+            printSortedPeers(accessedIpSort);
 
              std::cout << "-+----------------------------------------------------------+-\n" << std::endl;
         }
@@ -413,4 +1549,47 @@ void Graph<T>::getIPSummary(std::string searchedIp){
     }
 }
 
+template <class Table>
+void Graph<Table>::getIPInSummary(std::string searchedIp){
+    TraceScope traceSummary([&searchedIp](){ return "Graph::getIPInSummary " + searchedIp; });
+
+    int indexIp = findPosition(searchedIp); //buscar indice del ip en ips
+
+    if (indexIp != -1){
+        int nodoV = view.nodeIds[indexIp]; // obtener indice real en bitacora
+        if (aggregated){
+            std::cout << "-+----------------------------------------------------------+-" << std::endl;
+            std::cout << "|  Lista de direcciones que accedieron a la IP recibida:     |" << std::endl;
+            std::cout << "-+----------------------------------------------------------+-" << std::endl;
+            summarizePeers(nodoV, false);
+            std::cout << "-+----------------------------------------------------------+-\n" << std::endl;
+            return;
+        }
+
+        MaxHeap<ipAddress> accessingIpSort(view.degreeIn[indexIp]);
+
+        {
+            PerfScope perfNeighbors("getIPInSummary: vecinos de entrada");
+            forEachInNeighbor(nodoV, [this, &accessingIpSort](int indexNodoU, int, int){
+                int realIndex = view.posById[indexNodoU]; //indice en ips del origen
+                ipAddress source = materializeNode(realIndex);
+                source.showAccessedIp = true;
+                accessingIpSort.push(source);
+            });
+        }
+
+        TraceScope traceOutput("getIPInSummary: salida");
+        std::cout << "-+----------------------------------------------------------+-" << std::endl;
+        std::cout << "|  Lista de direcciones que accedieron a la IP recibida:     |" << std::endl;
+        std::cout << "-+----------------------------------------------------------+-" << std::endl;
+        printSortedPeers(accessingIpSort);
+
+        std::cout << "-+----------------------------------------------------------+-\n" << std::endl;
+    }
+
+    else{
+        throw std::invalid_argument("Direccion IP no encontrada en la Bitacora.");
+    }
+}
+
 #endif // _GRAPH_H_
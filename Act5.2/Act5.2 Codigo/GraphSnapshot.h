@@ -0,0 +1,558 @@
+#ifndef _GRAPH_SNAPSHOT_H_
+#define _GRAPH_SNAPSHOT_H_
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+/*
+ * Descripción:
+ *      Vista de sólo lectura de los arreglos que usan las consultas del grafo. Puede apuntar
+ *      a los vectores construidos por Graph::readGraph() o directamente a la memoria de un
+ *      snapshot mapeado con mmap, sin copiar ni convertir los datos.
+ */
+
+struct GraphView{
+    int numNodes = 0;
+    int numEdges = 0;
+    const std::uint32_t *ipValues = nullptr;
+    const int *nodeIds = nullptr;
+    const int *degreeIn = nullptr;
+    const int *degreeOut = nullptr;
+    const std::uint32_t *stringOffsets = nullptr;
+    const char *strings = nullptr;
+    const int *posById = nullptr;
+    const int *hashSlot = nullptr;
+    const int *adjOffsets = nullptr;
+    const int *adjNeighbors = nullptr;
+    const int *adjWeights = nullptr;
+    const int *inOffsets = nullptr;
+    const int *inNeighbors = nullptr;
+    const int *inWeights = nullptr;
+    const std::uint32_t *indexKeys = nullptr;
+    const int *indexValues = nullptr;
+    std::uint32_t indexCapacity = 0;
+    int indexShift = 32;
+};
+
+// Secciones del archivo, en el orden en que se escriben.
+enum SnapshotSection{
+    SECTION_IP_VALUES,
+    SECTION_NODE_IDS,
+    SECTION_DEGREE_IN,
+    SECTION_DEGREE_OUT,
+    SECTION_STRING_OFFSETS,
+    SECTION_STRINGS,
+    SECTION_POS_BY_ID,
+    SECTION_HASH_SLOT,
+    SECTION_ADJ_OFFSETS,
+    SECTION_ADJ_NEIGHBORS,
+    SECTION_ADJ_WEIGHTS,
+    SECTION_IN_OFFSETS,
+    SECTION_IN_NEIGHBORS,
+    SECTION_IN_WEIGHTS,
+    SECTION_INDEX_KEYS,
+    SECTION_INDEX_VALUES,
+    NUM_SNAPSHOT_SECTIONS
+};
+
+/*
+ * Descripción:
+ *      Encabezado del snapshot. Además de los tamaños guarda el tamaño y la fecha de
+ *      modificación de la bitácora de origen y la opción de tamaño de la tabla hash, para
+ *      descartar snapshots que ya no corresponden a la bitácora o a la opción elegida.
+ */
+
+struct SnapshotHeader{
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t numNodes;
+    std::uint32_t numEdges;
+    std::uint32_t indexCapacity;
+    std::int32_t indexShift;
+    std::int32_t option;
+    std::int32_t sizeHT;
+    std::int32_t numCollisions;
+    std::uint64_t stringBytes;
+    std::uint64_t sourceSize;
+    std::int64_t sourceTime;
+    std::uint64_t offsets[NUM_SNAPSHOT_SECTIONS];
+    std::uint64_t sizes[NUM_SNAPSHOT_SECTIONS];
+};
+
+class GraphSnapshot{
+private:
+    const char *base;
+    std::size_t length;
+    bool mapped;
+    std::vector<char> buffer;
+
+    static const std::uint32_t VERSION = 1;
+    static const std::size_t ALIGNMENT = 64;
+
+    /*
+     * Descripción: validate()
+     *      Revisa que el encabezado tenga la firma y versión esperadas y que todas las
+     *      secciones queden dentro del archivo con el tamaño que corresponde a sus conteos.
+     *      Después revisa el contenido que las consultas usan como índice, para que un
+     *      archivo dañado se rechace en lugar de provocar lecturas fuera de los arreglos:
+     *      el desplazamiento del índice, que los desplazamientos CSR y de cadenas inicien
+     *      en 0, no decrezcan y terminen en m y en stringBytes, que los identificadores,
+     *      posiciones y vecinos sean menores que n, que los grados coincidan con el CSR y
+     *      que el índice de direcciones deje al menos una casilla vacía.
+     *
+     * Parámetros de entrada:
+     *      No posee parámetros de entrada.
+     *
+     * Valor de retorno:
+     *      true si el snapshot es válido, false en caso contrario.
+     *
+     * Complejidad temporal:
+     *      O(n + m + c) donde c es el número de casillas del índice de direcciones.
+     */
+
+    bool validate() const;
+
+    /*
+     * Descripción: validOffsets()
+     *      Indica si un arreglo de desplazamientos de count + 1 entradas inicia en 0, no
+     *      decrece y termina en last.
+     *
+     * Parámetros de entrada:
+     *      @offsets: arreglo de desplazamientos.
+     *
+     *      @count: número de elementos que describe el arreglo.
+     *
+     *      @last: valor que debe tener la última entrada.
+     *
+     * Valor de retorno:
+     *      true si los desplazamientos son válidos, false en caso contrario.
+     *
+     * Complejidad temporal:
+     *      O(count)
+     */
+
+    template <class Offset>
+    static bool validOffsets(const Offset *offsets, std::uint64_t count, std::uint64_t last);
+
+public:
+
+    /*
+     * Descripción:
+     *      Constructor y destructor del snapshot. El destructor libera el mapeo de memoria.
+     *
+     * Parámetros de entrada:
+     *      No posee parámetros de entrada.
+     *
+     * Valor de retorno:
+     *      No retorna ningún valor.
+     *
+     * Complejidad temporal:
+     *      O(1)
+     */
+
+    GraphSnapshot();
+    ~GraphSnapshot();
+    GraphSnapshot(const GraphSnapshot &) = delete;
+    GraphSnapshot &operator=(const GraphSnapshot &) = delete;
+
+    /*
+     * Descripción: sourceStamp()
+     *      Obtiene el tamaño y la fecha de modificación de un archivo.
+     *
+     * Parámetros de entrada:
+     *      @fileName: nombre del archivo.
+     *
+     *      @size: referencia donde se guarda el tamaño en bytes.
+     *
+     *      @time: referencia donde se guarda la fecha de modificación.
+     *
+     * Valor de retorno:
+     *      true si el archivo existe, false en caso contrario.
+     *
+     * Complejidad temporal:
+     *      O(1)
+     */
+
+    static bool sourceStamp(const std::string &fileName, std::uint64_t &size, std::int64_t &time);
+
+    /*
+     * Descripción: write()
+     *      Escribe el encabezado y cada sección de la vista en un archivo. Cada sección
+     *      inicia en un desplazamiento múltiplo de 64 bytes para que, una vez mapeada, sus
+     *      arreglos queden alineados.
+     *
+     * Parámetros de entrada:
+     *      @fileName: nombre del archivo del snapshot.
+     *
+     *      @meta: encabezado con la opción, el tamaño de la tabla hash, las colisiones y la
+     *      información de la bitácora de origen; los tamaños y desplazamientos se calculan aquí.
+     *
+     *      @view: vista con los arreglos del grafo.
+     *
+     * Valor de retorno:
+     *      true si el archivo se escribió completo, false en caso contrario.
+     *
+     * Complejidad temporal:
+     *      O(n + m) donde n es el número de nodos y m el número de aristas.
+     */
+
+    static bool write(const std::string &fileName, SnapshotHeader meta, const GraphView &view);
+
+    /*
+     * Descripción: open()
+     *      Mapea un snapshot en memoria de sólo lectura (o lo lee completo en sistemas sin
+     *      mmap) y lo valida. No se convierte ningún dato: la vista resultante apunta dentro
+     *      del mapeo.
+     *
+     * Parámetros de entrada:
+     *      @fileName: nombre del archivo del snapshot.
+     *
+     * Valor de retorno:
+     *      true si el snapshot se abrió y es válido, false en caso contrario.
+     *
+     * Complejidad temporal:
+     *      O(n + m + c) por la validación del contenido; no se copia ningún dato.
+     */
+
+    bool open(const std::string &fileName);
+
+    /*
+     * Descripción: close() / isOpen()
+     *      Liberan el snapshot e indican si hay uno abierto.
+     *
+     * Parámetros de entrada:
+     *      No posee parámetros de entrada.
+     *
+     * Valor de retorno:
+     *      isOpen() devuelve true si hay un snapshot abierto.
+     *
+     * Complejidad temporal:
+     *      O(1)
+     */
+
+    void close();
+    bool isOpen() const;
+
+    /*
+     * Descripción: getHeader() / getView()
+     *      Devuelven el encabezado y la vista de los arreglos del snapshot abierto.
+     *
+     * Parámetros de entrada:
+     *      No posee parámetros de entrada.
+     *
+     * Valor de retorno:
+     *      Encabezado o vista del snapshot.
+     *
+     * Complejidad temporal:
+     *      O(1)
+     */
+
+    const SnapshotHeader &getHeader() const;
+    GraphView getView() const;
+};
+
+inline GraphSnapshot::GraphSnapshot(){
+    base = nullptr;
+    length = 0;
+    mapped = false;
+}
+
+inline GraphSnapshot::~GraphSnapshot(){
+    close();
+}
+
+inline bool GraphSnapshot::sourceStamp(const std::string &fileName, std::uint64_t &size, std::int64_t &time){
+#if defined(__unix__) || defined(__APPLE__)
+    struct stat info;
+
+    if (stat(fileName.c_str(), &info) != 0){
+        return false;
+    }
+
+    size = (std::uint64_t)info.st_size;
+    time = (std::int64_t)info.st_mtime;
+    return true;
+#else
+    std::ifstream file(fileName, std::ios::binary | std::ios::ate);
+
+    if (!file.is_open()){
+        return false;
+    }
+
+    size = (std::uint64_t)file.tellg();
+    time = 0;
+    return true;
+#endif
+}
+
+inline bool GraphSnapshot::write(const std::string &fileName, SnapshotHeader meta, const GraphView &view){
+    const std::uint64_t n = (std::uint64_t)view.numNodes;
+    const std::uint64_t m = (std::uint64_t)view.numEdges;
+    const void *data[NUM_SNAPSHOT_SECTIONS] = {
+        view.ipValues, view.nodeIds, view.degreeIn, view.degreeOut, view.stringOffsets, view.strings,
+        view.posById, view.hashSlot, view.adjOffsets, view.adjNeighbors, view.adjWeights,
+        view.inOffsets, view.inNeighbors, view.inWeights, view.indexKeys, view.indexValues};
+    const std::uint64_t sizes[NUM_SNAPSHOT_SECTIONS] = {
+        n * 4, n * 4, n * 4, n * 4, (n + 1) * 4, view.stringOffsets[n],
+        n * 4, n * 4, (n + 1) * 4, m * 4, m * 4,
+        (n + 1) * 4, m * 4, m * 4, (std::uint64_t)view.indexCapacity * 4, (std::uint64_t)view.indexCapacity * 4};
+
+    std::memcpy(meta.magic, "BITGRAF1", 8);
+    meta.version = VERSION;
+    meta.numNodes = (std::uint32_t)n;
+    meta.numEdges = (std::uint32_t)m;
+    meta.indexCapacity = view.indexCapacity;
+    meta.indexShift = view.indexShift;
+    meta.stringBytes = view.stringOffsets[n];
+
+    std::uint64_t offset = (sizeof(SnapshotHeader) + ALIGNMENT - 1) / ALIGNMENT * ALIGNMENT;
+
+    for (int s = 0; s < NUM_SNAPSHOT_SECTIONS; s++){
+        meta.offsets[s] = offset;
+        meta.sizes[s] = sizes[s];
+        offset = (offset + sizes[s] + ALIGNMENT - 1) / ALIGNMENT * ALIGNMENT;
+    }
+
+    // Se escribe en un archivo temporal y se renombra, para no dejar snapshots a medias.
+    std::string temporary = fileName + ".tmp";
+    std::ofstream file(temporary, std::ios::binary | std::ios::trunc);
+
+    if (!file.is_open()){
+        return false;
+    }
+
+    const char padding[ALIGNMENT] = {0};
+    std::uint64_t written = 0;
+    file.write(reinterpret_cast<const char *>(&meta), sizeof(meta));
+    written += sizeof(meta);
+
+    for (int s = 0; s < NUM_SNAPSHOT_SECTIONS; s++){
+        file.write(padding, (std::streamsize)(meta.offsets[s] - written));
+        file.write(static_cast<const char *>(data[s]), (std::streamsize)sizes[s]);
+        written = meta.offsets[s] + sizes[s];
+    }
+
+    file.close();
+
+    if (!file.good()){
+        std::remove(temporary.c_str());
+        return false;
+    }
+
+    return std::rename(temporary.c_str(), fileName.c_str()) == 0;
+}
+
+inline bool GraphSnapshot::open(const std::string &fileName){
+    close();
+
+#if defined(__unix__) || defined(__APPLE__)
+    int fd = ::open(fileName.c_str(), O_RDONLY);
+
+    if (fd < 0){
+        return false;
+    }
+
+    struct stat info;
+
+    if (fstat(fd, &info) != 0 || (std::size_t)info.st_size < sizeof(SnapshotHeader)){
+        ::close(fd);
+        return false;
+    }
+
+    void *address = mmap(nullptr, (std::size_t)info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+
+    if (address == MAP_FAILED){
+        return false;
+    }
+
+    base = static_cast<const char *>(address);
+    length = (std::size_t)info.st_size;
+    mapped = true;
+#else
+    std::ifstream file(fileName, std::ios::binary | std::ios::ate);
+
+    if (!file.is_open()){
+        return false;
+    }
+
+    std::streamsize size = file.tellg();
+
+    if (size < (std::streamsize)sizeof(SnapshotHeader)){
+        return false;
+    }
+
+    buffer.resize((std::size_t)size);
+    file.seekg(0);
+    file.read(buffer.data(), size);
+    base = buffer.data();
+    length = buffer.size();
+#endif
+
+    if (!validate()){
+        close();
+        return false;
+    }
+
+    return true;
+}
+
+inline bool GraphSnapshot::validate() const{
+    const SnapshotHeader &header = getHeader();
+
+    if (std::memcmp(header.magic, "BITGRAF1", 8) != 0 || header.version != VERSION){
+        return false;
+    }
+
+    const std::uint64_t n = header.numNodes;
+    const std::uint64_t m = header.numEdges;
+    const std::uint64_t expected[NUM_SNAPSHOT_SECTIONS] = {
+        n * 4, n * 4, n * 4, n * 4, (n + 1) * 4, header.stringBytes,
+        n * 4, n * 4, (n + 1) * 4, m * 4, m * 4,
+        (n + 1) * 4, m * 4, m * 4, (std::uint64_t)header.indexCapacity * 4, (std::uint64_t)header.indexCapacity * 4};
+
+    for (int s = 0; s < NUM_SNAPSHOT_SECTIONS; s++){
+
+        if (header.sizes[s] != expected[s] || header.offsets[s] % ALIGNMENT != 0 || header.offsets[s] + header.sizes[s] > length){
+            return false;
+        }
+    }
+
+    // La capacidad del índice debe ser potencia de dos para que la máscara sea válida, y el
+    // desplazamiento debe conservar exactamente log2(capacidad) bits del hash.
+    std::uint32_t capacity = header.indexCapacity;
+    int bits = 0;
+
+    if (n > 0x7fffffffu || m > 0x7fffffffu || capacity == 0 || (capacity & (capacity - 1)) != 0){
+        return false;
+    }
+
+    while ((1u << bits) < capacity){
+        bits++;
+    }
+
+    if (header.indexShift != 32 - bits || bits == 0){
+        return false;
+    }
+
+    GraphView view = getView();
+    const int nodes = view.numNodes;
+
+    if (!validOffsets(view.stringOffsets, n, header.stringBytes) || !validOffsets(view.adjOffsets, n, m) || !validOffsets(view.inOffsets, n, m)){
+        return false;
+    }
+
+    for (int pos = 0; pos < nodes; pos++){
+        int id = view.nodeIds[pos];
+
+        if (id < 0 || id >= nodes || view.posById[id] != pos || view.hashSlot[pos] < -1 || view.hashSlot[pos] >= header.sizeHT){
+            return false;
+        }
+
+        if (view.degreeOut[pos] != view.adjOffsets[id + 1] - view.adjOffsets[id] || view.degreeIn[pos] != view.inOffsets[id + 1] - view.inOffsets[id]){
+            return false;
+        }
+    }
+
+    for (std::uint64_t e = 0; e < m; e++){
+
+        if (view.adjNeighbors[e] < 0 || view.adjNeighbors[e] >= nodes || view.inNeighbors[e] < 0 || view.inNeighbors[e] >= nodes){
+            return false;
+        }
+    }
+
+    std::uint64_t used = 0;
+
+    for (std::uint32_t slot = 0; slot < capacity; slot++){
+
+        if (view.indexValues[slot] < -1 || view.indexValues[slot] >= nodes){
+            return false;
+        }
+
+        used += (view.indexValues[slot] != -1) ? 1 : 0;
+    }
+
+    return used == n && used < capacity;
+}
+
+template <class Offset>
+bool GraphSnapshot::validOffsets(const Offset *offsets, std::uint64_t count, std::uint64_t last){
+
+    if (offsets[0] != 0 || (std::uint64_t)offsets[count] != last){
+        return false;
+    }
+
+    for (std::uint64_t i = 0; i < count; i++){
+
+        if (offsets[i + 1] < offsets[i]){
+            return false;
+        }
+    }
+
+    return true;
+}
+
+inline void GraphSnapshot::close(){
+#if defined(__unix__) || defined(__APPLE__)
+    if (mapped && base != nullptr){
+        munmap(const_cast<char *>(base), length);
+    }
+#endif
+
+    buffer.clear();
+    base = nullptr;
+    length = 0;
+    mapped = false;
+}
+
+inline bool GraphSnapshot::isOpen() const{
+    return base != nullptr;
+}
+
+inline const SnapshotHeader &GraphSnapshot::getHeader() const{
+    return *reinterpret_cast<const SnapshotHeader *>(base);
+}
+
+inline GraphView GraphSnapshot::getView() const{
+    const SnapshotHeader &header = getHeader();
+    GraphView view;
+
+    auto section = [this, &header](int s){
+        return base + header.offsets[s];
+    };
+
+    view.numNodes = (int)header.numNodes;
+    view.numEdges = (int)header.numEdges;
+    view.ipValues = reinterpret_cast<const std::uint32_t *>(section(SECTION_IP_VALUES));
+    view.nodeIds = reinterpret_cast<const int *>(section(SECTION_NODE_IDS));
+    view.degreeIn = reinterpret_cast<const int *>(section(SECTION_DEGREE_IN));
+    view.degreeOut = reinterpret_cast<const int *>(section(SECTION_DEGREE_OUT));
+    view.stringOffsets = reinterpret_cast<const std::uint32_t *>(section(SECTION_STRING_OFFSETS));
+    view.strings = section(SECTION_STRINGS);
+    view.posById = reinterpret_cast<const int *>(section(SECTION_POS_BY_ID));
+    view.hashSlot = reinterpret_cast<const int *>(section(SECTION_HASH_SLOT));
+    view.adjOffsets = reinterpret_cast<const int *>(section(SECTION_ADJ_OFFSETS));
+    view.adjNeighbors = reinterpret_cast<const int *>(section(SECTION_ADJ_NEIGHBORS));
+    view.adjWeights = reinterpret_cast<const int *>(section(SECTION_ADJ_WEIGHTS));
+    view.inOffsets = reinterpret_cast<const int *>(section(SECTION_IN_OFFSETS));
+    view.inNeighbors = reinterpret_cast<const int *>(section(SECTION_IN_NEIGHBORS));
+    view.inWeights = reinterpret_cast<const int *>(section(SECTION_IN_WEIGHTS));
+    view.indexKeys = reinterpret_cast<const std::uint32_t *>(section(SECTION_INDEX_KEYS));
+    view.indexValues = reinterpret_cast<const int *>(section(SECTION_INDEX_VALUES));
+    view.indexCapacity = header.indexCapacity;
+    view.indexShift = header.indexShift;
+    return view;
+}
+
+#endif // _GRAPH_SNAPSHOT_H_
@@ -4,6 +4,7 @@
 #include <vector>
 #include <algorithm>
 #include <iterator>
+#include "MemoryTracker.h"
 
 template <class K, class T>
 class HashNode{
@@ -11,7 +12,7 @@ private:
     K key;
     T data;
     int status;                // 0 empty,  1 used,  2 deleted
-    std::vector<int> overflow; 
+    std::vector<int, TrackingAllocator<int, MemoryTag::HashTable>> overflow; 
 
 public:
     /*
@@ -329,7 +330,7 @@ int HashNode<K, T>::getOverflowAt(int index){
 
 template <class K, class T>
 void HashNode<K, T>::removeFromOverflow(int index){
-    std::vector<int>::iterator it = std::find(overflow.begin(), overflow.end(), index);
+    auto it = std::find(overflow.begin(), overflow.end(), index);
  
     if (it != overflow.end()){
         overflow.erase(overflow.begin() + (it - overflow.begin()));
@@ -0,0 +1,200 @@
+#ifndef _HASH_POLICIES_H_
+#define _HASH_POLICIES_H_
+
+#include <chrono>
+#include <cstdint>
+#include <random>
+#include <type_traits>
+#include <utility>
+#include "Numbers.h"
+
+/*
+ * Descripción:
+ *      Políticas intercambiables de HashTable. Una política de hash (Hasher) convierte la
+ *      llave en un valor de 64 bits con hash(); una política de tamaño (Sizing) decide el
+ *      número de celdas, la celda inicial a partir del hash y la secuencia de sondeo.
+ *
+ *      - IdentityHash: la llave tal cual (el comportamiento original, key % maxSize).
+ *      - FibonacciHash: multiplicación por 2^64 / φ conservando los 32 bits altos del
+ *        producto, que dependen de todos los bits de la llave.
+ *      - Mix64Hash: finalizador de splitmix64 (dos rondas de corrimiento y multiplicación),
+ *        la mezcla más fuerte y la más cara de las tres.
+ *      - KeyedHash: SipHash-2-4 con una llave secreta aleatoria por tabla. Las anteriores son
+ *        públicas, así que quien controla las IP de la bitácora puede elegir direcciones que
+ *        caigan en la misma celda; sin la llave no es posible. Es la única política con
+ *        estado: HashTable la vuelve a sembrar (reseed()) si una lista de desbordamiento
+ *        rebasa su límite.
+ *
+ *      - PrimeSizing: número de celdas primo, celda inicial hash % tamaño y sondeo cuadrático
+ *        (el comportamiento original).
+ *      - PowerOfTwoSizing: número de celdas potencia de dos, celda inicial con una máscara de
+ *        bits y sondeo triangular (home + i(i+1)/2), que visita todas las celdas. Evita la
+ *        división y la búsqueda de primos, pero sólo funciona bien con un hash que mezcle
+ *        los bits bajos (FibonacciHash o Mix64Hash).
+ *
+ * Complejidad temporal:
+ *      O(1) por operación, salvo growCapacity() de PrimeSizing, que busca el siguiente primo
+ *      por división de prueba. growCapacity(minimum) devuelve la menor capacidad válida que
+ *      no es menor que minimum en ambas políticas.
+ */
+
+struct IdentityHash{
+    static const char *name(){
+        return "identidad";
+    }
+
+    static std::uint64_t hash(std::uint64_t key){
+        return key;
+    }
+};
+
+struct FibonacciHash{
+    static const char *name(){
+        return "fibonacci";
+    }
+
+    static std::uint64_t hash(std::uint64_t key){
+        return (key * 0x9E3779B97F4A7C15ull) >> 32;
+    }
+};
+
+struct Mix64Hash{
+    static const char *name(){
+        return "mix64";
+    }
+
+    static std::uint64_t hash(std::uint64_t key){
+        key ^= key >> 30;
+        key *= 0xBF58476D1CE4E5B9ull;
+        key ^= key >> 27;
+        key *= 0x94D049BB133111EBull;
+        return key ^ (key >> 31);
+    }
+};
+
+class KeyedHash{
+private:
+    std::uint64_t key0;
+    std::uint64_t key1;
+
+    static std::uint64_t rotate(std::uint64_t value, int bits){
+        return (value << bits) | (value >> (64 - bits));
+    }
+
+    static void sipRound(std::uint64_t &v0, std::uint64_t &v1, std::uint64_t &v2, std::uint64_t &v3){
+        v0 += v1; v1 = rotate(v1, 13); v1 ^= v0; v0 = rotate(v0, 32);
+        v2 += v3; v3 = rotate(v3, 16); v3 ^= v2;
+        v0 += v3; v3 = rotate(v3, 21); v3 ^= v0;
+        v2 += v1; v1 = rotate(v1, 17); v1 ^= v2; v2 = rotate(v2, 32);
+    }
+
+public:
+    KeyedHash(){
+        reseed();
+    }
+
+    static const char *name(){
+        return "siphash";
+    }
+
+    // Nueva llave secreta: random_device mezclado con el reloj, por si random_device es
+    // determinista en la plataforma.
+    void reseed(){
+        std::random_device device;
+        std::uint64_t clock = (std::uint64_t)std::chrono::steady_clock::now().time_since_epoch().count();
+        key0 = ((std::uint64_t)device() << 32 | device()) ^ clock;
+        key1 = ((std::uint64_t)device() << 32 | device()) ^ rotate(clock, 29) ^ (std::uint64_t)(std::uintptr_t)this;
+    }
+
+    // SipHash-2-4 de un mensaje de 8 bytes (la llave).
+    std::uint64_t hash(std::uint64_t key) const{
+        std::uint64_t v0 = key0 ^ 0x736F6D6570736575ull;
+        std::uint64_t v1 = key1 ^ 0x646F72616E646F6Dull;
+        std::uint64_t v2 = key0 ^ 0x6C7967656E657261ull;
+        std::uint64_t v3 = key1 ^ 0x7465646279746573ull;
+        std::uint64_t last = 8ull << 56;
+
+        v3 ^= key;
+        sipRound(v0, v1, v2, v3);
+        sipRound(v0, v1, v2, v3);
+        v0 ^= key;
+        v3 ^= last;
+        sipRound(v0, v1, v2, v3);
+        sipRound(v0, v1, v2, v3);
+        v0 ^= last;
+        v2 ^= 0xFF;
+
+        for (int round = 0; round < 4; round++){
+            sipRound(v0, v1, v2, v3);
+        }
+
+        return v0 ^ v1 ^ v2 ^ v3;
+    }
+};
+
+// IsKeyedHash<H>::value es true si la política H se puede volver a sembrar con reseed().
+template <class H, class = void>
+struct IsKeyedHash : std::false_type {};
+
+template <class H>
+struct IsKeyedHash<H, std::void_t<decltype(std::declval<H &>().reseed())>> : std::true_type {};
+
+struct PrimeSizing{
+    static const char *name(){
+        return "primo";
+    }
+
+    // Con un tamaño fijo se respeta el primo elegido por el usuario.
+    static int fixedCapacity(int requested){
+        return requested;
+    }
+
+    // Menor primo que no es menor que minimum.
+    static int growCapacity(int minimum){
+        Numbers primes;
+        return primes.findClosePrime(minimum - 1)[0];
+    }
+
+    static int home(std::uint64_t hash, int size){
+        return (int)(hash % (std::uint64_t)size);
+    }
+
+    static int probe(int home, int i, int size){
+        return (int)(((long long)home + (long long)i * i) % size);
+    }
+};
+
+struct PowerOfTwoSizing{
+    static const char *name(){
+        return "potencia de 2";
+    }
+
+    static constexpr int fixedCapacity(int requested){
+        int capacity = 1;
+
+        while (capacity < requested){
+            capacity <<= 1;
+        }
+
+        return capacity;
+    }
+
+    // Menor potencia de dos que no es menor que minimum; al crecer con 2 * maxSize la tabla
+    // exactamente duplica su tamaño.
+    static constexpr int growCapacity(int minimum){
+        return fixedCapacity(minimum);
+    }
+
+    static int home(std::uint64_t hash, int size){
+        return (int)(hash & (std::uint64_t)(size - 1));
+    }
+
+    static int probe(int home, int i, int size){
+        return (int)(((long long)home + (long long)i * (i + 1) / 2) & (size - 1));
+    }
+};
+
+static_assert(PowerOfTwoSizing::growCapacity(2 * 16) == 32 && PowerOfTwoSizing::growCapacity(2 * 1024) == 2048,
+              "PowerOfTwoSizing::growCapacity debe duplicar una capacidad potencia de dos");
+
+#endif // _HASH_POLICIES_H_
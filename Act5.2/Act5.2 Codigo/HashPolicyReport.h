@@ -0,0 +1,121 @@
+#ifndef _HASH_POLICY_REPORT_H_
+#define _HASH_POLICY_REPORT_H_
+
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include "HashPolicies.h"
+#include "HashTable.h"
+
+/*
+ * Descripción: reportHashPolicy()
+ *      Construye una HashTable<uint32_t, int, Hasher, Sizing> con las llaves recibidas e
+ *      imprime un renglón con su tamaño, factor de carga, colisiones al insertar, longitud
+ *      promedio y máxima de las búsquedas exitosas, inserciones fallidas y tiempo de
+ *      construcción. Con detailed imprime debajo las estadísticas detalladas de la tabla.
+ *
+ * Parámetros de entrada:
+ *      @keys: llaves a insertar (valores enteros de las direcciones IP).
+ *
+ *      @numKeys: número de llaves.
+ *
+ *      @size: tamaño solicitado de la tabla (la política puede redondearlo).
+ *
+ *      @os: flujo de salida del reporte.
+ *
+ *      @detailed: true para imprimir también las estadísticas detalladas (HashStats).
+ *
+ * Valor de retorno:
+ *      No retorna ningún valor.
+ *
+ * Complejidad temporal:
+ *      O(n) en promedio, donde n es el número de llaves.
+ */
+
+template <class Hasher, class Sizing>
+void reportHashPolicy(const std::uint32_t *keys, int numKeys, int size, std::ostream &os, bool detailed = false){
+    HashTable<std::uint32_t, int, Hasher, Sizing> table;
+    table.setMaxSize(size);
+    int failed = 0;
+    auto start = std::chrono::steady_clock::now();
+
+    for (int k = 0; k < numKeys; k++){
+
+        try{
+            table.add(keys[k], k);
+        }
+
+        catch (const std::exception &){
+            failed++;
+        }
+    }
+
+    double micros = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+    long long totalProbes = 0;
+    int maxProbes = 0;
+
+    for (int k = 0; k < numKeys; k++){
+        int probes = table.getProbeLength(keys[k]);
+        totalProbes += probes;
+        maxProbes = (probes > maxProbes) ? probes : maxProbes;
+    }
+
+    std::string policy = std::string(Hasher::name()) + " / " + Sizing::name();
+    os << std::left << std::setw(26) << policy << std::right << std::setw(9) << table.getCapacity()
+       << std::fixed << std::setprecision(2) << std::setw(7) << (double)table.getNumElements() / table.getCapacity()
+       << std::setw(11) << table.getNumCollisions()
+       << std::setw(9) << (numKeys > 0 ? (double)totalProbes / numKeys : 0.0)
+       << std::setw(7) << maxProbes << std::setw(8) << failed
+       << std::setprecision(0) << std::setw(10) << micros << std::defaultfloat << std::endl;
+
+    if (detailed){
+        table.getStats().print(os);
+        os << std::endl;
+    }
+}
+
+/*
+ * Descripción: printHashPolicyReport()
+ *      Compara todas las combinaciones de función hash y política de tamaño de HashPolicies.h
+ *      sobre el mismo conjunto de llaves, para elegir la política con datos.
+ *
+ * Parámetros de entrada:
+ *      @keys: llaves a insertar (valores enteros de las direcciones IP).
+ *
+ *      @numKeys: número de llaves.
+ *
+ *      @size: tamaño solicitado de la tabla.
+ *
+ *      @os: flujo de salida del reporte.
+ *
+ *      @detailed: true para imprimir las estadísticas detalladas de cada política.
+ *
+ * Valor de retorno:
+ *      No retorna ningún valor.
+ *
+ * Complejidad temporal:
+ *      O(n) en promedio por política.
+ */
+
+inline void printHashPolicyReport(const std::uint32_t *keys, int numKeys, int size, std::ostream &os, bool detailed = false){
+    os << "-+----------------------------------------------------------+-" << std::endl;
+    os << "|      Politicas de la tabla hash con las IP de la bitacora  |" << std::endl;
+    os << "-+----------------------------------------------------------+-" << std::endl;
+    os << std::left << std::setw(26) << "hash / tamano" << std::right << std::setw(9) << "celdas" << std::setw(7) << "carga"
+       << std::setw(11) << "colisiones" << std::setw(9) << "sondeo" << std::setw(7) << "max" << std::setw(8) << "fallas"
+       << std::setw(10) << "us" << std::endl;
+    reportHashPolicy<IdentityHash, PrimeSizing>(keys, numKeys, size, os, detailed);
+    reportHashPolicy<FibonacciHash, PrimeSizing>(keys, numKeys, size, os, detailed);
+    reportHashPolicy<Mix64Hash, PrimeSizing>(keys, numKeys, size, os, detailed);
+    reportHashPolicy<IdentityHash, PowerOfTwoSizing>(keys, numKeys, size, os, detailed);
+    reportHashPolicy<FibonacciHash, PowerOfTwoSizing>(keys, numKeys, size, os, detailed);
+    reportHashPolicy<Mix64Hash, PowerOfTwoSizing>(keys, numKeys, size, os, detailed);
+    reportHashPolicy<KeyedHash, PrimeSizing>(keys, numKeys, size, os, detailed);
+    reportHashPolicy<KeyedHash, PowerOfTwoSizing>(keys, numKeys, size, os, detailed);
+    os << "-+----------------------------------------------------------+-" << std::endl;
+}
+
+#endif // _HASH_POLICY_REPORT_H_
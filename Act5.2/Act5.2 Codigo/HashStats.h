@@ -0,0 +1,198 @@
+#ifndef _HASH_STATS_H_
+#define _HASH_STATS_H_
+
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+/*
+ * Descripción:
+ *      Estadísticas detalladas de una tabla hash: histogramas de la longitud de sondeo (celdas
+ *      revisadas) de las inserciones, de las búsquedas exitosas y de las búsquedas fallidas,
+ *      sus máximos, el factor de carga, las celdas borradas (tumbas, estado 2), cuántas
+ *      inserciones reutilizaron una tumba, cuántas veces se compactó la tabla y cuántas
+ *      celdas iniciales tienen una lista de desbordamiento de cada tamaño. La última columna
+ *      de cada histograma acumula los sondeos de HISTOGRAM_SIZE celdas o más.
+ *
+ *      A diferencia de getNumCollisions(), que sólo cuenta las celdas ocupadas revisadas
+ *      después de la inicial, insertCollisions también cuenta la celda inicial ocupada: es
+ *      la suma de (celdas revisadas - 1) de todas las inserciones.
+ *
+ * Complejidad temporal:
+ *      O(1) por registro; print() es O(HISTOGRAM_SIZE + tamaño máximo de lista).
+ */
+
+struct HashStats{
+    static constexpr int HISTOGRAM_SIZE = 16;
+
+    int capacity;
+    int elements;
+    int tombstones;
+    int tombstoneReuses;
+    int compactions;
+    long long insertHistogram[HISTOGRAM_SIZE];
+    long long hitHistogram[HISTOGRAM_SIZE];
+    long long missHistogram[HISTOGRAM_SIZE];
+    long long insertTotal;
+    long long hitTotal;
+    long long missTotal;
+    long long insertCollisions;
+    int maxInsertProbe;
+    int maxHitProbe;
+    int maxMissProbe;
+    // overflowSizes[s]: celdas iniciales (ocupadas o borradas) con s celdas en su lista.
+    std::vector<int> overflowSizes;
+
+    HashStats(){
+        clear();
+    }
+
+    /*
+     * Descripción: clear()
+     *      Deja todos los contadores en cero.
+     *
+     * Parámetros de entrada:
+     *      No posee parámetros de entrada.
+     *
+     * Valor de retorno:
+     *      No retorna ningún valor.
+     *
+     * Complejidad temporal:
+     *      O(HISTOGRAM_SIZE)
+     */
+
+    void clear(){
+        capacity = 0;
+        elements = 0;
+        tombstones = 0;
+        tombstoneReuses = 0;
+        compactions = 0;
+        insertTotal = hitTotal = missTotal = insertCollisions = 0;
+        maxInsertProbe = maxHitProbe = maxMissProbe = 0;
+
+        for (int k = 0; k < HISTOGRAM_SIZE; k++){
+            insertHistogram[k] = hitHistogram[k] = missHistogram[k] = 0;
+        }
+
+        overflowSizes.clear();
+    }
+
+    /*
+     * Descripción: recordInsert() / recordHit() / recordMiss() / recordOverflow()
+     *      Registran una inserción, una búsqueda exitosa o una búsqueda fallida que revisó
+     *      probes celdas, o una celda inicial con una lista de desbordamiento de size celdas.
+     *
+     * Parámetros de entrada:
+     *      @probes: celdas revisadas (al menos 1).
+     *
+     *      @size: tamaño de la lista de desbordamiento.
+     *
+     * Valor de retorno:
+     *      No retorna ningún valor.
+     *
+     * Complejidad temporal:
+     *      O(1) amortizado.
+     */
+
+    void recordInsert(int probes){
+        record(insertHistogram, insertTotal, maxInsertProbe, probes);
+        insertCollisions += probes - 1;
+    }
+
+    void recordHit(int probes){
+        record(hitHistogram, hitTotal, maxHitProbe, probes);
+    }
+
+    void recordMiss(int probes){
+        record(missHistogram, missTotal, maxMissProbe, probes);
+    }
+
+    void recordOverflow(int size){
+
+        if ((int)overflowSizes.size() <= size){
+            overflowSizes.resize(size + 1, 0);
+        }
+
+        overflowSizes[size]++;
+    }
+
+    /*
+     * Descripción: loadFactor()
+     *      Devuelve elementos / celdas.
+     *
+     * Parámetros de entrada:
+     *      No posee parámetros de entrada.
+     *
+     * Valor de retorno:
+     *      Factor de carga, o 0 si la tabla no tiene celdas.
+     *
+     * Complejidad temporal:
+     *      O(1)
+     */
+
+    double loadFactor() const{
+        return (capacity == 0) ? 0.0 : (double)elements / capacity;
+    }
+
+    /*
+     * Descripción: print()
+     *      Imprime las estadísticas con el formato de las tablas del programa.
+     *
+     * Parámetros de entrada:
+     *      @os: flujo de salida.
+     *
+     * Valor de retorno:
+     *      No retorna ningún valor.
+     *
+     * Complejidad temporal:
+     *      O(HISTOGRAM_SIZE + tamaño máximo de lista).
+     */
+
+    void print(std::ostream &os) const{
+        os << "celdas: " << capacity << "  elementos: " << elements << "  carga: " << std::fixed << std::setprecision(2)
+           << loadFactor() << "  tumbas: " << tombstones << " (reutilizadas: " << tombstoneReuses << ", compactaciones: " << compactions
+           << ")  colisiones (con la celda inicial): " << insertCollisions << std::endl;
+        os << std::left << std::setw(13) << "sondeos" << std::right;
+
+        for (int k = 1; k < HISTOGRAM_SIZE; k++){
+            os << std::setw(6) << k;
+        }
+
+        os << std::setw(6) << (std::to_string(HISTOGRAM_SIZE) + "+") << std::setw(9) << "prom" << std::setw(6) << "max" << std::endl;
+        printRow(os, "insercion", insertHistogram, insertTotal, maxInsertProbe);
+        printRow(os, "busqueda si", hitHistogram, hitTotal, maxHitProbe);
+        printRow(os, "busqueda no", missHistogram, missTotal, maxMissProbe);
+        os << "desbordamiento (tamano de lista: celdas iniciales):";
+
+        for (int size = 0; size < (int)overflowSizes.size(); size++){
+
+            if (overflowSizes[size] > 0){
+                os << "  " << size << ": " << overflowSizes[size];
+            }
+        }
+
+        os << std::defaultfloat << std::endl;
+    }
+
+private:
+    static void record(long long *histogram, long long &total, int &maxProbe, int probes){
+        histogram[(probes < HISTOGRAM_SIZE ? probes : HISTOGRAM_SIZE) - 1]++;
+        total += probes;
+        maxProbe = (probes > maxProbe) ? probes : maxProbe;
+    }
+
+    static void printRow(std::ostream &os, const char *label, const long long *histogram, long long total, int maxProbe){
+        long long count = 0;
+        os << std::left << std::setw(13) << label << std::right;
+
+        for (int k = 0; k < HISTOGRAM_SIZE; k++){
+            os << std::setw(6) << histogram[k];
+            count += histogram[k];
+        }
+
+        os << std::fixed << std::setprecision(2) << std::setw(9) << (count > 0 ? (double)total / count : 0.0) << std::setw(6) << maxProbe << std::endl;
+    }
+};
+
+#endif // _HASH_STATS_H_
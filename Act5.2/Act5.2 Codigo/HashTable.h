@@ -5,14 +5,317 @@
 #include <iostream>
 #include <stdexcept>
 #include "HashNode.h"
+#include "MemoryTracker.h"
+#include "HashPolicies.h"
+#include "HashStats.h"
 
-template <class K, class T>
+/*
+ * Descripción:
+ *      Tabla hash con sondeo y listas de desbordamiento por celda inicial. La función hash
+ *      (Hasher) y la política de tamaño y sondeo (Sizing) son parámetros de la plantilla; por
+ *      omisión se usa la llave tal cual con un tamaño primo y sondeo cuadrático. Las políticas
+ *      disponibles están en HashPolicies.h.
+ *
+ *      Con una función hash con llave secreta (KeyedHash) la tabla además acota el peor caso:
+ *      ninguna inserción deja una lista de desbordamiento de más de MAX_CHAIN celdas, así que
+ *      find() revisa a lo más MAX_CHAIN + 1 celdas por tabla. Si una inserción lo rebasaría,
+ *      la tabla elige otra llave secreta y reacomoda todos sus elementos.
+ *
+ *      remove() deja la celda borrada (estado 2, una tumba) y conserva su lista de
+ *      desbordamiento, que sigue sirviendo a las demás llaves con esa celda inicial. Las
+ *      inserciones reutilizan las tumbas y, cuando las tumbas rebasan la cuarta parte de las
+ *      celdas, la tabla se compacta: reinserta sus elementos en una tabla limpia del mismo
+ *      tamaño, empezando por los que tienen libre su celda inicial, para que ningún elemento
+ *      ocupe la celda inicial de otro sólo por el orden de las inserciones anteriores.
+ */
+
+template <class K, class T, class Hasher = IdentityHash, class Sizing = PrimeSizing>
 class HashTable{
 private:
-    std::vector<HashNode<K, T>> table;
+    typedef std::vector<HashNode<K, T>, TrackingAllocator<HashNode<K, T>, MemoryTag::HashTable>> NodeVector;
+
+    NodeVector table;
     int numElements;
     int numCollisions;
     int maxSize;
+    // Histograma de sondeo de las inserciones en la tabla actual; getStats() completa el resto.
+    HashStats insertStats;
+
+    // Crecimiento automático: al rebasar el factor de carga la tabla anterior pasa a oldTable
+    // y sus celdas se trasladan a table unas cuantas a la vez (migrateCursor indica la
+    // siguiente), para que ninguna inserción pague el rehash completo.
+    bool autoGrow;
+    NodeVector oldTable;
+    int oldSize;
+    int migrateCursor;
+    static const int MIGRATE_STEP = 8;
+
+    // Función hash; las políticas sin llave no tienen estado y sólo KeyedHash usa numReseeds.
+    Hasher hasher;
+    int numReseeds;
+    static const int MAX_CHAIN = 16;
+    static const int MAX_RESEEDS = 8;
+
+    // Tumbas de la tabla actual y umbral de compactación (ver compact()).
+    int numTombstones;
+    int numTombstoneReuses;
+    int numCompactions;
+    int compactAt;
+    static const int COMPACT_DIVISOR = 4;
+
+    // HashTableImage lee las celdas y las listas de desbordamiento para escribir la imagen.
+    template <class, class, class> friend class HashTableImage;
+
+    /*
+     * Descripión: homeOf()
+     *      Calcula la celda inicial de una llave en una tabla de size celdas con las políticas
+     *      Hasher y Sizing.
+     *
+     * Parámetros de entrada:
+     *      @keyValue: llave.
+     *
+     *      @size: número de celdas de la tabla.
+     *
+     * Valor de retorno:
+     *      Índice de la celda inicial.
+     *
+     * Complejidad temporal:
+     *      O(1)
+     */
+
+    int homeOf(K keyValue, int size);
+
+    /*
+     * Descripión: insertInto()
+     *      Coloca la pareja (keyValue, dataValue) en la tabla indicada con sondeo cuadrático y
+     *      registra la celda en la lista de desbordamiento de su celda inicial. Con un tamaño
+     *      primo el sondeo cuadrático sólo alcanza cerca de la mitad de las celdas, y los
+     *      tamaños fijos del menú trabajan con un factor de carga cercano a 1; por eso, después
+     *      de size intentos, se recorren las celdas en orden a partir de la inicial. find() sigue
+     *      la lista de desbordamiento, así que no depende de cómo se eligió la celda.
+     *
+     * Parámetros de entrada:
+     *      @nodes: tabla donde se inserta.
+     *
+     *      @size: número de celdas de la tabla.
+     *
+     *      @keyValue: llave del elemento.
+     *
+     *      @dataValue: valor del elemento.
+     *
+     * Valor de retorno:
+     *      Celda donde quedó el elemento, o -1 si la tabla no tiene celdas libres.
+     *
+     * Complejidad temporal:
+     *      O(1) en promedio; O(size) en el peor caso.
+     */
+
+    int insertInto(NodeVector &nodes, int size, K keyValue, T dataValue);
+
+    /*
+     * Descripión: findIn()
+     *      Busca una llave en la tabla indicada revisando su celda inicial y la lista de
+     *      desbordamiento de esa celda.
+     *
+     * Parámetros de entrada:
+     *      @nodes: tabla donde se busca.
+     *
+     *      @size: número de celdas de la tabla.
+     *
+     *      @keyValue: llave buscada.
+     *
+     *      @probes: referencia a la que se suma el número de celdas revisadas.
+     *
+     * Valor de retorno:
+     *      Celda de la llave, o -1 si no está en esa tabla.
+     *
+     * Complejidad temporal:
+     *      O(1 + tamaño de la lista de desbordamiento).
+     */
+
+    int findIn(NodeVector &nodes, int size, K keyValue, int &probes);
+
+    /*
+     * Descripión: removeFrom()
+     *      Elimina el elemento de la celda pos de la tabla indicada y lo quita de la lista de
+     *      desbordamiento de su celda inicial.
+     *
+     * Parámetros de entrada:
+     *      @nodes: tabla de la que se elimina.
+     *
+     *      @size: número de celdas de la tabla.
+     *
+     *      @pos: celda del elemento.
+     *
+     *      @keyValue: llave del elemento.
+     *
+     * Valor de retorno:
+     *      No retorna ningún valor.
+     *
+     * Complejidad temporal:
+     *      O(tamaño de la lista de desbordamiento).
+     */
+
+    void removeFrom(NodeVector &nodes, int size, int pos, K keyValue);
+
+    /*
+     * Descripión: findCounting()
+     *      Implementación de find() que además cuenta las celdas revisadas, en la tabla actual
+     *      y, si hay un traslado pendiente, en la tabla anterior.
+     *
+     * Parámetros de entrada:
+     *      @keyValue: llave buscada.
+     *
+     *      @probes: referencia a la que se suma el número de celdas revisadas.
+     *
+     * Valor de retorno:
+     *      El mismo índice que find().
+     *
+     * Complejidad temporal:
+     *      O(1 + tamaño de la lista de desbordamiento).
+     */
+
+    int findCounting(K keyValue, int &probes);
+
+    /*
+     * Descripión: migrateStep()
+     *      Traslada a la tabla nueva hasta MIGRATE_STEP celdas de la tabla anterior. Cuando la
+     *      tabla anterior queda vacía se libera. Con KeyedHash, si un traslado deja una lista de
+     *      desbordamiento de más de MAX_CHAIN celdas, se llama a boundMigration().
+     *
+     * Parámetros de entrada:
+     *      No posee parámetros de entrada.
+     *
+     * Valor de retorno:
+     *      No retorna ningún valor.
+     *
+     * Complejidad temporal:
+     *      O(MIGRATE_STEP) en promedio.
+     */
+
+    void migrateStep();
+
+    /*
+     * Descripión: grow()
+     *      Termina cualquier traslado pendiente y reemplaza la tabla por una vacía con el tamaño
+     *      que da Sizing::growCapacity() para el doble del actual; la tabla actual pasa a ser la tabla
+     *      anterior, que se traslada poco a poco en las operaciones siguientes.
+     *
+     * Parámetros de entrada:
+     *      No posee parámetros de entrada.
+     *
+     * Valor de retorno:
+     *      No retorna ningún valor.
+     *
+     * Complejidad temporal:
+     *      O(n) para reservar la tabla nueva; el traslado se reparte en las operaciones siguientes.
+     */
+
+    void grow();
+
+    /*
+     * Descripión: chainFull() / chainsBounded() / rebuildFrom()
+     *      chainFull() indica si la lista de desbordamiento de la celda inicial de una llave ya
+     *      tiene MAX_CHAIN celdas y chainsBounded() si ninguna lista las rebasa. rebuildFrom()
+     *      llena una tabla nueva del mismo tamaño con los elementos de source usando la función
+     *      hash actual: primero coloca en su celda inicial los elementos que la encuentran libre
+     *      y después sondea para los demás.
+     *
+     * Parámetros de entrada:
+     *      @keyValue: llave.
+     *
+     *      @source: tabla con los elementos a reacomodar.
+     *
+     * Valor de retorno:
+     *      chainFull() y chainsBounded(): true si la lista está llena o si todas están acotadas.
+     *      rebuildFrom(): true si todos los elementos cupieron.
+     *
+     * Complejidad temporal:
+     *      O(1), O(n) y O(n) en promedio, respectivamente.
+     */
+
+    bool chainFull(K keyValue);
+    bool chainsBounded();
+    bool rebuildFrom(NodeVector &source);
+
+    /*
+     * Descripión: boundChain()
+     *      Antes de insertar una llave con KeyedHash, revisa que la lista de desbordamiento de
+     *      su celda inicial tenga lugar. Si ya tiene MAX_CHAIN celdas, termina el traslado
+     *      pendiente y la tabla cambia de llave secreta con reseed(); si no basta, crece (con
+     *      tamaño automático) o lanza std::out_of_range.
+     *
+     * Parámetros de entrada:
+     *      @keyValue: llave que se va a insertar.
+     *
+     * Valor de retorno:
+     *      No retorna ningún valor.
+     *
+     * Complejidad temporal:
+     *      O(1), u O(n) en promedio cuando hay que reacomodar la tabla.
+     */
+
+    void boundChain(K keyValue);
+
+    /*
+     * Descripión: reseed()
+     *      Cambia la llave secreta de KeyedHash y reacomoda la tabla (sin traslado pendiente)
+     *      hasta MAX_RESEEDS veces, hasta que ninguna lista rebase MAX_CHAIN celdas y, si pending
+     *      es true, la lista de keyValue tenga lugar para una celda más. Si no lo logra, recupera
+     *      la llave y la tabla anteriores.
+     *
+     * Parámetros de entrada:
+     *      @keyValue: llave que se va a insertar.
+     *
+     *      @pending: true si keyValue se insertará después del reacomodo.
+     *
+     * Valor de retorno:
+     *      true si la tabla quedó acotada, false si se recuperó la anterior.
+     *
+     * Complejidad temporal:
+     *      O(MAX_RESEEDS * n) en el peor caso; O(n) en promedio.
+     */
+
+    bool reseed(K keyValue, bool pending);
+
+    /*
+     * Descripión: boundMigration()
+     *      Con KeyedHash, cuando un traslado rebasa MAX_CHAIN: termina de trasladar la tabla
+     *      anterior (la llave secreta no puede cambiar mientras haya celdas calculadas con la
+     *      anterior), reacomoda con reseed() y, si no basta, vuelve a crecer.
+     *
+     * Parámetros de entrada:
+     *      No posee parámetros de entrada.
+     *
+     * Valor de retorno:
+     *      No retorna ningún valor.
+     *
+     * Complejidad temporal:
+     *      O(n) en promedio.
+     */
+
+    void boundMigration();
+
+    /*
+     * Descripión: compact()
+     *      Termina cualquier traslado pendiente y reacomoda los elementos en una tabla limpia
+     *      del mismo tamaño (rebuildFrom()), lo que elimina todas las tumbas. Si con tamaño fijo
+     *      y un factor de carga mayor a 0.5 algún elemento ya no encuentra celda con el sondeo,
+     *      recupera la tabla anterior y pospone el siguiente intento hasta que se acumulen otras
+     *      maxSize / COMPACT_DIVISOR tumbas, para que el costo siga repartido entre los remove().
+     *
+     * Parámetros de entrada:
+     *      No posee parámetros de entrada.
+     *
+     * Valor de retorno:
+     *      No retorna ningún valor.
+     *
+     * Complejidad temporal:
+     *      O(n) en promedio; como se hace después de maxSize / COMPACT_DIVISOR eliminaciones,
+     *      cuesta O(1) amortizado por remove().
+     */
+
+    void compact();
 
 public:
 
@@ -58,7 +361,8 @@ public:
      *      Método utilizado para establecer el tamaño máximo de la tabla hash y realizar
      *      una reestructuración apropiada cuando se cambia el tamaño. La función asigna
      *      un nuevo tamaño máximo a la tabla y crea un nuevo vector de nodos hash (table)
-     *      con el nuevo tamaño, eliminando cualquier contenido anterior.
+     *      con el nuevo tamaño, eliminando cualquier contenido anterior. La política Sizing
+     *      puede redondear el tamaño (por ejemplo, a una potencia de dos).
      *
      * Parámetros de entrada:
      *      @selectedMaxSize: un número entero que representa el nuevo tamaño máximo 
@@ -81,8 +385,8 @@ public:
      *
      * Parámetros de entrada:
      *      @keyValue: que es la clave para la cual se desea calcular el índice de hash. 
-     *      La clave (K) puede ser de cualquier tipo de datos que sea válido para el 
-     *      operador % (módulo).
+     *      La clave (K) puede ser de cualquier tipo entero; se dispersa con Hasher y se
+     *      ubica en la tabla con Sizing.
      *
      * Valor de retorno:
      *      El método devuelve un valor entero que representa el índice de hash calculado 
@@ -159,7 +463,10 @@ public:
      * Descripión: find()
      *      Método utilizado para buscar una clave (keyValue) en la tabla hash y devolver el
      *      índice donde se encuentra el elemento. Si la clave no se encuentra en la tabla,
-     *      el método devuelve -1 para indicar que la búsqueda no tuvo éxito.
+     *      el método devuelve -1 para indicar que la búsqueda no tuvo éxito. Mientras se
+     *      traslada una tabla anterior, los elementos que siguen en ella se devuelven con el
+     *      índice maxSize + celda; el índice deja de ser válido después del siguiente add()
+     *      o remove().
      *
      * Parámetros de entrada:
      *      keyValue: la clave que se desea buscar en la tabla hash.
@@ -205,7 +512,8 @@ public:
      *      diferente del índice de hash (hashIndex), significa que el elemento está en una celda
      *      de desbordamiento y no en la celda principal. En este caso, la función elimina el índice
      *      pos de la lista de desbordamientos de la celda principal (hashIndex). Esta operación
-     *      implica utilizar el método removeFromOverflow de la clase HashNode.
+     *      implica utilizar el método removeFromOverflow de la clase HashNode. La celda queda
+     *      como tumba; si las tumbas rebasan maxSize / COMPACT_DIVISOR la tabla se compacta.
      *
      * Parámetros de entrada:
      *      @keyValue: la clave del elemento que se desea eliminar de la tabla hash.
@@ -241,44 +549,251 @@ public:
      */
 
     int getNumCollisions();
+
+    /*
+     * Descripión: setAutomaticSize()
+     *      Vacía la tabla y activa el crecimiento automático: la tabla inicia con el tamaño que
+     *      da Sizing::growCapacity() para el doble de expected (el primer primo que no es menor,
+     *      con PrimeSizing) y, cada vez que una inserción haría que el factor de carga superara
+     *      0.5, crece de la misma forma al doble de su tamaño. Los
+     *      elementos se trasladan a la tabla nueva de forma incremental (MIGRATE_STEP celdas
+     *      por cada add() o remove()), mientras tanto find() busca en ambas tablas. En este
+     *      modo add() no lanza la excepción de tabla llena. setMaxSize() regresa al modo de
+     *      tamaño fijo.
+     *
+     * Parámetros de entrada:
+     *      @expected: número de elementos esperado; puede ser una estimación.
+     *
+     * Valor de retorno:
+     *      No retorna ningún valor.
+     *
+     * Complejidad temporal:
+     *      O(expected)
+     */
+
+    void setAutomaticSize(int expected);
+
+    /*
+     * Descripión: getCapacity()
+     *      Devuelve el número de celdas de la tabla actual (sin contar la tabla anterior que se
+     *      está trasladando).
+     *
+     * Parámetros de entrada:
+     *      No posee parámetros de entrada.
+     *
+     * Valor de retorno:
+     *      Número de celdas.
+     *
+     * Complejidad temporal:
+     *      O(1)
+     */
+
+    int getCapacity();
+
+    /*
+     * Descripión: getProbeLength()
+     *      Devuelve el número de celdas que revisa find() para la llave: la celda inicial más
+     *      las celdas de su lista de desbordamiento revisadas hasta encontrarla (o todas si
+     *      no está).
+     *
+     * Parámetros de entrada:
+     *      @keyValue: llave buscada.
+     *
+     * Valor de retorno:
+     *      Número de celdas revisadas.
+     *
+     * Complejidad temporal:
+     *      O(1 + tamaño de la lista de desbordamiento).
+     */
+
+    int getProbeLength(K keyValue);
+
+    /*
+     * Descripión: getStats()
+     *      Devuelve las estadísticas detalladas de la tabla (HashStats.h). El histograma de las
+     *      inserciones se registra al insertar; el de las búsquedas exitosas se obtiene buscando
+     *      cada elemento guardado y el de las fallidas suponiendo una búsqueda fallida por cada
+     *      celda inicial posible, que revisa la celda y, si está ocupada, su lista de
+     *      desbordamiento.
+     *
+     * Parámetros de entrada:
+     *      No posee parámetros de entrada.
+     *
+     * Valor de retorno:
+     *      Estadísticas de la tabla.
+     *
+     * Complejidad temporal:
+     *      O(n + m) en promedio, donde n es el número de celdas y m el de elementos.
+     */
+
+    HashStats getStats();
+
+    /*
+     * Descripión: getNumReseeds()
+     *      Devuelve cuántas veces la tabla cambió de llave secreta para acotar sus listas de
+     *      desbordamiento (siempre 0 con las funciones hash sin llave).
+     *
+     * Parámetros de entrada:
+     *      No posee parámetros de entrada.
+     *
+     * Valor de retorno:
+     *      Número de cambios de llave.
+     *
+     * Complejidad temporal:
+     *      O(1)
+     */
+
+    int getNumReseeds();
+
+    /*
+     * Descripión: getNumTombstones() / getNumTombstoneReuses() / getNumCompactions()
+     *      Devuelven las celdas borradas (tumbas) de la tabla actual, cuántas inserciones
+     *      reutilizaron una tumba y cuántas veces se compactó la tabla.
+     *
+     * Parámetros de entrada:
+     *      No posee parámetros de entrada.
+     *
+     * Valor de retorno:
+     *      El contador correspondiente.
+     *
+     * Complejidad temporal:
+     *      O(1)
+     */
+
+    int getNumTombstones();
+    int getNumTombstoneReuses();
+    int getNumCompactions();
 };
 
-template <class K, class T>
-HashTable<K, T>::HashTable(){
+/*
+ * Descripión: getHashStats()
+ *      Obtiene las estadísticas detalladas de una tabla con la interfaz de HashTable. Sólo
+ *      HashTable las lleva; para los demás motores esta versión devuelve false y la
+ *      sobrecarga de HashTable las copia.
+ *
+ * Parámetros de entrada:
+ *      @table: tabla de la que se obtienen las estadísticas.
+ *
+ *      @stats: referencia donde se guardan.
+ *
+ * Valor de retorno:
+ *      true si la tabla tiene estadísticas detalladas, false si no.
+ *
+ * Complejidad temporal:
+ *      O(1), u O(n + m) para HashTable.
+ */
+
+template <class Table>
+bool getHashStats(Table &, HashStats &){
+    return false;
+}
+
+template <class K, class T, class Hasher, class Sizing>
+bool getHashStats(HashTable<K, T, Hasher, Sizing> &table, HashStats &stats){
+    stats = table.getStats();
+    return true;
+}
+
+/*
+ * Descripión: insertAll()
+ *      Inserta count elementos en una tabla con la interfaz de HashTable, uno por uno. Las
+ *      tablas que admiten inserciones concurrentes (ConcurrentHashTable) tienen su propia
+ *      versión en paralelo, que la sobrecarga elige automáticamente.
+ *
+ * Parámetros de entrada:
+ *      @table: tabla donde se insertan los elementos.
+ *
+ *      @count: número de elementos.
+ *
+ *      @keyOf: función que devuelve la llave del elemento i.
+ *
+ *      @valueOf: función que devuelve el valor del elemento i.
+ *
+ * Valor de retorno:
+ *      No retorna ningún valor.
+ *
+ * Complejidad temporal:
+ *      O(n) en promedio.
+ */
+
+template <class Table, class KeyOf, class ValueOf>
+void insertAll(Table &table, int count, KeyOf keyOf, ValueOf valueOf){
+
+    for (int i = 0; i < count; i++){
+        table.add(keyOf(i), valueOf(i));
+    }
+}
+
+template <class K, class T, class Hasher, class Sizing>
+HashTable<K, T, Hasher, Sizing>::HashTable(){
     maxSize = 0;
     numElements = 0;
     numCollisions = 0;
-    table = std::vector<HashNode<K, T>>(maxSize);
+    autoGrow = false;
+    oldSize = 0;
+    migrateCursor = 0;
+    numReseeds = 0;
+    numTombstones = 0;
+    numTombstoneReuses = 0;
+    numCompactions = 0;
+    compactAt = 0;
+    table = decltype(table)(maxSize);
 }
 
-template <class K, class T>
-HashTable<K, T>::~HashTable(){
+template <class K, class T, class Hasher, class Sizing>
+HashTable<K, T, Hasher, Sizing>::~HashTable(){
     maxSize = 0;
     numElements = 0;
     numCollisions = 0;
-    table = std::vector<HashNode<K, T>>(maxSize);
+    table = decltype(table)(maxSize);
+    oldTable = decltype(oldTable)();
+    oldSize = 0;
 }
 
-template <class K, class T>
-void HashTable<K, T>::setMaxSize(int selectedMaxSize){
-    maxSize = selectedMaxSize;
+template <class K, class T, class Hasher, class Sizing>
+void HashTable<K, T, Hasher, Sizing>::setMaxSize(int selectedMaxSize){
+    maxSize = Sizing::fixedCapacity(selectedMaxSize);
     numElements = 0;
     numCollisions = 0;
-    table = std::vector<HashNode<K, T>>(maxSize);
+    insertStats.clear();
+    autoGrow = false;
+    table = decltype(table)(maxSize);
+    oldTable = decltype(oldTable)();
+    oldSize = 0;
+    migrateCursor = 0;
+    numTombstones = 0;
+    compactAt = maxSize / COMPACT_DIVISOR;
 }
 
-template <class K, class T>
-int HashTable<K, T>::getHashIndex(K keyValue){
-    return keyValue % maxSize;
+template <class K, class T, class Hasher, class Sizing>
+void HashTable<K, T, Hasher, Sizing>::setAutomaticSize(int expected){
+    maxSize = Sizing::growCapacity(2 * (expected > 8 ? expected : 8));
+    setMaxSize(maxSize);
+    autoGrow = true;
 }
 
-template <class K, class T>
-int HashTable<K, T>::getNumElements(){
+template <class K, class T, class Hasher, class Sizing>
+int HashTable<K, T, Hasher, Sizing>::getHashIndex(K keyValue){
+    return homeOf(keyValue, maxSize);
+}
+
+template <class K, class T, class Hasher, class Sizing>
+int HashTable<K, T, Hasher, Sizing>::homeOf(K keyValue, int size){
+    return Sizing::home(hasher.hash((std::uint64_t)keyValue), size);
+}
+
+template <class K, class T, class Hasher, class Sizing>
+int HashTable<K, T, Hasher, Sizing>::getNumElements(){
     return numElements;
 }
 
-template <class K, class T>
-void HashTable<K, T>::print(){
+template <class K, class T, class Hasher, class Sizing>
+int HashTable<K, T, Hasher, Sizing>::getCapacity(){
+    return maxSize;
+}
+
+template <class K, class T, class Hasher, class Sizing>
+void HashTable<K, T, Hasher, Sizing>::print(){
     std::cout << "Contenido de la tabla hash" << std::endl;
 
     for (int i = 0; i < maxSize; i++){
@@ -287,12 +802,291 @@ void HashTable<K, T>::print(){
             std::cout << "Celda: " << i << " Key: " << table[i].getKey() << ", Value: " << table[i].getData() << ", Overflow.size: " << table[i].getOverflowSize() << std::endl;
         }
     }
+
+    for (int i = migrateCursor; i < oldSize; i++){
+
+        if (oldTable[i].getStatus() == 1){
+            std::cout << "Celda anterior: " << i << " Key: " << oldTable[i].getKey() << ", Value: " << oldTable[i].getData() << std::endl;
+        }
+    }
+}
+
+template <class K, class T, class Hasher, class Sizing>
+int HashTable<K, T, Hasher, Sizing>::insertInto(NodeVector &nodes, int size, K keyValue, T dataValue){
+    int hashIndex = homeOf(keyValue, size);
+    HashNode<K, T> &node = nodes[hashIndex];
+
+    if (node.getStatus() != 1){ 
+
+        if (node.getStatus() == 2){
+            numTombstones--;
+            numTombstoneReuses++;
+        }
+
+        node.setKey(keyValue);
+        node.setData(dataValue);
+        insertStats.recordInsert(1);
+        return hashIndex;
+    }
+
+    for (int i = 1; i < 2 * size; i++){
+        int currentHashIndex = (i < size) ? Sizing::probe(hashIndex, i, size) : (hashIndex + i - size + 1) % size;
+        HashNode<K, T> &currentNode = nodes[currentHashIndex];
+
+        if (currentNode.getStatus() != 1){
+
+            if (currentNode.getStatus() == 2){
+                numTombstones--;
+                numTombstoneReuses++;
+            }
+
+            currentNode.setKey(keyValue);
+            currentNode.setData(dataValue);
+            node.addToOverflow(currentHashIndex);
+            insertStats.recordInsert(i + 1);
+            return currentHashIndex;
+        }
+
+        numCollisions++;
+    }
+
+    return -1;
+}
+
+template <class K, class T, class Hasher, class Sizing>
+void HashTable<K, T, Hasher, Sizing>::migrateStep(){
+    bool overflowed = false;
+
+    for (int moved = 0; moved < MIGRATE_STEP && migrateCursor < oldSize; moved++, migrateCursor++){
+        HashNode<K, T> &node = oldTable[migrateCursor];
+
+        if (node.getStatus() != 1){
+            continue;
+        }
+
+        // La tabla nueva tiene más celdas que elementos la anterior, así que siempre hay lugar.
+        if (insertInto(table, maxSize, node.getKey(), node.getData()) == -1){
+            throw std::out_of_range("No se pudo trasladar un elemento de la hash table");
+        }
+
+        if constexpr (IsKeyedHash<Hasher>::value){
+            overflowed = overflowed || (int)table[homeOf(node.getKey(), maxSize)].getOverflowSize() > MAX_CHAIN;
+        }
+    }
+
+    if (oldSize > 0 && migrateCursor >= oldSize){
+        oldTable = decltype(oldTable)();
+        oldSize = 0;
+        migrateCursor = 0;
+    }
+
+    if constexpr (IsKeyedHash<Hasher>::value){
+
+        if (overflowed){
+            boundMigration();
+        }
+    }
+}
+
+template <class K, class T, class Hasher, class Sizing>
+void HashTable<K, T, Hasher, Sizing>::boundMigration(){
+
+    for (; migrateCursor < oldSize; migrateCursor++){
+        HashNode<K, T> &node = oldTable[migrateCursor];
+
+        if (node.getStatus() == 1 && insertInto(table, maxSize, node.getKey(), node.getData()) == -1){
+            throw std::out_of_range("No se pudo trasladar un elemento de la hash table");
+        }
+    }
+
+    oldTable = decltype(oldTable)();
+    oldSize = 0;
+    migrateCursor = 0;
+
+    if (chainsBounded() || reseed(K(), false)){
+        return;
+    }
+
+    // Sin traslado pendiente, grow() no vuelve a llamar a esta función antes de crecer.
+    grow();
+}
+
+template <class K, class T, class Hasher, class Sizing>
+void HashTable<K, T, Hasher, Sizing>::grow(){
+
+    while (oldSize > 0){
+        migrateStep();
+    }
+
+    oldTable.swap(table);
+    oldSize = maxSize;
+    migrateCursor = 0;
+    maxSize = Sizing::growCapacity(2 * maxSize);
+    table = decltype(table)(maxSize);
+    // Las colisiones describen la tabla actual; los traslados las vuelven a contar.
+    numCollisions = 0;
+    insertStats.clear();
+    numTombstones = 0;
+    compactAt = maxSize / COMPACT_DIVISOR;
+}
+
+template <class K, class T, class Hasher, class Sizing>
+bool HashTable<K, T, Hasher, Sizing>::chainFull(K keyValue){
+    HashNode<K, T> &home = table[homeOf(keyValue, maxSize)];
+    return home.getStatus() != 0 && (int)home.getOverflowSize() >= MAX_CHAIN;
+}
+
+template <class K, class T, class Hasher, class Sizing>
+bool HashTable<K, T, Hasher, Sizing>::chainsBounded(){
+
+    for (int i = 0; i < maxSize; i++){
+
+        if ((int)table[i].getOverflowSize() > MAX_CHAIN){
+            return false;
+        }
+    }
+
+    return true;
+}
+
+template <class K, class T, class Hasher, class Sizing>
+bool HashTable<K, T, Hasher, Sizing>::rebuildFrom(NodeVector &source){
+    table = NodeVector(maxSize);
+    numCollisions = 0;
+    insertStats.clear();
+    numTombstones = 0;
+
+    for (int i = 0; i < maxSize; i++){
+
+        if (source[i].getStatus() == 1 && table[homeOf(source[i].getKey(), maxSize)].getStatus() == 0){
+            insertInto(table, maxSize, source[i].getKey(), source[i].getData());
+        }
+    }
+
+    for (int i = 0; i < maxSize; i++){
+
+        if (source[i].getStatus() != 1){
+            continue;
+        }
+
+        HashNode<K, T> &home = table[homeOf(source[i].getKey(), maxSize)];
+
+        if (home.getStatus() == 1 && home.getKey() == source[i].getKey()){
+            continue;
+        }
+
+        if (insertInto(table, maxSize, source[i].getKey(), source[i].getData()) == -1){
+            return false;
+        }
+    }
+
+    return true;
+}
+
+template <class K, class T, class Hasher, class Sizing>
+bool HashTable<K, T, Hasher, Sizing>::reseed(K keyValue, bool pending){
+    NodeVector previous;
+    previous.swap(table);
+    Hasher previousHasher = hasher;
+    int previousCollisions = numCollisions;
+    HashStats previousStats = insertStats;
+    int previousTombstones = numTombstones;
+
+    for (int attempt = 0; attempt < MAX_RESEEDS; attempt++){
+        hasher.reseed();
+        numReseeds++;
+
+        if (rebuildFrom(previous) && chainsBounded() && !(pending && chainFull(keyValue))){
+            return true;
+        }
+    }
+
+    hasher = previousHasher;
+    table.swap(previous);
+    numCollisions = previousCollisions;
+    insertStats = previousStats;
+    numTombstones = previousTombstones;
+    return false;
 }
 
-template <class K, class T>
-void HashTable<K, T>::add(K keyValue, T dataValue){
+template <class K, class T, class Hasher, class Sizing>
+void HashTable<K, T, Hasher, Sizing>::boundChain(K keyValue){
+
+    if (!chainFull(keyValue)){
+        return;
+    }
+
+    while (oldSize > 0){
+        migrateStep();
+    }
+
+    // Terminar el traslado pudo haber reacomodado o hecho crecer la tabla.
+    if (!chainFull(keyValue) || reseed(keyValue, true)){
+        return;
+    }
+
+    if (!autoGrow){
+        throw std::out_of_range("No se pudo acotar la lista de desbordamiento de la hash table");
+    }
 
-    if (numElements == maxSize){
+    grow();
+
+    while (oldSize > 0){
+        migrateStep();
+    }
+}
+
+template <class K, class T, class Hasher, class Sizing>
+int HashTable<K, T, Hasher, Sizing>::getNumReseeds(){
+    return numReseeds;
+}
+
+template <class K, class T, class Hasher, class Sizing>
+void HashTable<K, T, Hasher, Sizing>::compact(){
+
+    while (oldSize > 0){
+        migrateStep();
+    }
+
+    NodeVector previous;
+    previous.swap(table);
+    int previousCollisions = numCollisions;
+    HashStats previousStats = insertStats;
+    int previousTombstones = numTombstones;
+
+    // Con KeyedHash la tabla compactada también debe respetar MAX_CHAIN.
+    if (rebuildFrom(previous) && (!IsKeyedHash<Hasher>::value || chainsBounded())){
+        numCompactions++;
+        compactAt = maxSize / COMPACT_DIVISOR;
+        return;
+    }
+
+    table.swap(previous);
+    numCollisions = previousCollisions;
+    insertStats = previousStats;
+    numTombstones = previousTombstones;
+    compactAt = numTombstones + maxSize / COMPACT_DIVISOR;
+}
+
+template <class K, class T, class Hasher, class Sizing>
+int HashTable<K, T, Hasher, Sizing>::getNumTombstones(){
+    return numTombstones;
+}
+
+template <class K, class T, class Hasher, class Sizing>
+int HashTable<K, T, Hasher, Sizing>::getNumTombstoneReuses(){
+    return numTombstoneReuses;
+}
+
+template <class K, class T, class Hasher, class Sizing>
+int HashTable<K, T, Hasher, Sizing>::getNumCompactions(){
+    return numCompactions;
+}
+
+template <class K, class T, class Hasher, class Sizing>
+void HashTable<K, T, Hasher, Sizing>::add(K keyValue, T dataValue){
+
+    if (!autoGrow && numElements == maxSize){
         throw std::out_of_range("La hash table esta llena");
     }
 
@@ -300,50 +1094,59 @@ void HashTable<K, T>::add(K keyValue, T dataValue){
         throw std::out_of_range("El elemento ya existe en la tabla hash");
     }
 
-    int hashIndex = getHashIndex(keyValue);
-    HashNode<K, T> node = table[hashIndex];
+    if (autoGrow){
+        migrateStep();
 
-    if (node.getStatus() != 1){ 
-        node.setKey(keyValue);
-        node.setData(dataValue);
-        table[hashIndex] = node;
+        if (2 * (numElements + 1) > maxSize){
+            grow();
+            migrateStep();
+        }
     }
 
-    else{
-        int i = 1;
-        int currentHashIndex = getHashIndex(hashIndex + i * i);
-        HashNode<K, T> currentNode = table[currentHashIndex];
-
-        while (currentNode.getStatus() == 1){
-            i++;
-            currentHashIndex = getHashIndex(hashIndex + i * i);
-            currentNode = table[currentHashIndex];
-            numCollisions++;
+    if constexpr (IsKeyedHash<Hasher>::value){
+        boundChain(keyValue);
+    }
+
+    if (insertInto(table, maxSize, keyValue, dataValue) == -1){
+
+        if (!autoGrow){
+            throw std::out_of_range("La hash table esta llena");
+        }
+
+        grow();
+
+        while (oldSize > 0){
+            migrateStep();
         }
 
-        currentNode.setKey(keyValue);
-        currentNode.setData(dataValue);
-        node.addToOverflow(currentHashIndex);
-        table[currentHashIndex] = currentNode;
-        table[hashIndex] = node;
+        insertInto(table, maxSize, keyValue, dataValue);
     }
+
     numElements++;
 }
 
-template <class K, class T>
-int HashTable<K, T>::find(K keyValue){
-    int hashIndex = getHashIndex(keyValue);
-    HashNode<K, T> node = table[hashIndex];
+template <class K, class T, class Hasher, class Sizing>
+int HashTable<K, T, Hasher, Sizing>::findIn(NodeVector &nodes, int size, K keyValue, int &probes){
+
+    if (size == 0){
+        return -1;
+    }
+
+    int hashIndex = homeOf(keyValue, size);
+    HashNode<K, T> &node = nodes[hashIndex];
+    probes++;
 
-    if (node.getStatus() == 1){
+    // Una celda inicial borrada conserva su lista: las demás llaves con esa celda siguen ahí.
+    if (node.getStatus() != 0){
 
-        if (node.getKey() == keyValue)
+        if (node.getStatus() == 1 && node.getKey() == keyValue)
             return hashIndex;
 
         for (int i = 0; i < (int)node.getOverflowSize(); i++){
             int overflowIndex = node.getOverflowAt(i);
+            probes++;
 
-            if (table[overflowIndex].getKey() == keyValue)
+            if (nodes[overflowIndex].getKey() == keyValue)
                 return overflowIndex;
         }
 
@@ -353,35 +1156,115 @@ int HashTable<K, T>::find(K keyValue){
     return -1;
 }
 
-template <class K, class T>
-T HashTable<K, T>::getDataAt(int index){
-    return table[index].getData();
+template <class K, class T, class Hasher, class Sizing>
+int HashTable<K, T, Hasher, Sizing>::find(K keyValue){
+    int probes = 0;
+    return findCounting(keyValue, probes);
+}
+
+template <class K, class T, class Hasher, class Sizing>
+int HashTable<K, T, Hasher, Sizing>::getProbeLength(K keyValue){
+    int probes = 0;
+    findCounting(keyValue, probes);
+    return probes;
 }
 
-template <class K, class T>
-int HashTable<K, T>::getNumCollisions(){
+template <class K, class T, class Hasher, class Sizing>
+int HashTable<K, T, Hasher, Sizing>::findCounting(K keyValue, int &probes){
+    int pos = findIn(table, maxSize, keyValue, probes);
+
+    if (pos == -1 && oldSize > 0){
+        int oldPos = findIn(oldTable, oldSize, keyValue, probes);
+        // Las celdas anteriores a migrateCursor ya se trasladaron; su copia no es válida.
+        pos = (oldPos >= migrateCursor) ? maxSize + oldPos : -1;
+    }
+
+    return pos;
+}
+
+template <class K, class T, class Hasher, class Sizing>
+T HashTable<K, T, Hasher, Sizing>::getDataAt(int index){
+    return (index >= maxSize) ? oldTable[index - maxSize].getData() : table[index].getData();
+}
+
+template <class K, class T, class Hasher, class Sizing>
+int HashTable<K, T, Hasher, Sizing>::getNumCollisions(){
     return numCollisions;
 }
 
-template <class K, class T>
-void HashTable<K, T>::remove(K keyValue){
-    int pos, hashIndex;
-    pos = find(keyValue);
+template <class K, class T, class Hasher, class Sizing>
+void HashTable<K, T, Hasher, Sizing>::removeFrom(NodeVector &nodes, int size, int pos, K keyValue){
+    int hashIndex = homeOf(keyValue, size);
+
+    if (pos != hashIndex){
+        nodes[hashIndex].removeFromOverflow(pos);
+    }
+
+    nodes[pos].clearData();
+}
+
+template <class K, class T, class Hasher, class Sizing>
+void HashTable<K, T, Hasher, Sizing>::remove(K keyValue){
+    int pos = find(keyValue);
 
     if (pos == -1){
         throw std::out_of_range("El elemento no existe en la tabla hash");
     }
 
-    hashIndex = getHashIndex(keyValue);
+    if (pos >= maxSize){
+        removeFrom(oldTable, oldSize, pos - maxSize, keyValue);
+    }
 
-    if (pos != hashIndex){
-        HashNode<K, T> node = table[hashIndex];
-        node.removeFromOverflow(pos);
-        table[hashIndex] = node;
+    else{
+        removeFrom(table, maxSize, pos, keyValue);
+        numTombstones++;
     }
 
-    table[pos].clearData();
     numElements--;
+
+    if (autoGrow){
+        migrateStep();
+    }
+
+    if (numTombstones > compactAt){
+        compact();
+    }
+}
+
+template <class K, class T, class Hasher, class Sizing>
+HashStats HashTable<K, T, Hasher, Sizing>::getStats(){
+    HashStats stats = insertStats;
+    stats.capacity = maxSize;
+    stats.elements = numElements;
+    stats.tombstoneReuses = numTombstoneReuses;
+    stats.compactions = numCompactions;
+
+    for (int i = 0; i < maxSize; i++){
+        HashNode<K, T> &node = table[i];
+
+        if (node.getStatus() == 2){
+            stats.tombstones++;
+        }
+
+        if (node.getStatus() != 0){
+            stats.recordOverflow((int)node.getOverflowSize());
+        }
+
+        stats.recordMiss(node.getStatus() != 0 ? 1 + (int)node.getOverflowSize() : 1);
+
+        if (node.getStatus() == 1){
+            stats.recordHit(getProbeLength(node.getKey()));
+        }
+    }
+
+    for (int i = migrateCursor; i < oldSize; i++){
+
+        if (oldTable[i].getStatus() == 1){
+            stats.recordHit(getProbeLength(oldTable[i].getKey()));
+        }
+    }
+
+    return stats;
 }
 
-#endif // _HASH_TABLE_H_
\ No newline at end of file
+#endif // _HASH_TABLE_H_
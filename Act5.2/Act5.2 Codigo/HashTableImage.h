@@ -0,0 +1,677 @@
+#ifndef _HASH_TABLE_IMAGE_H_
+#define _HASH_TABLE_IMAGE_H_
+
+#include <climits>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <type_traits>
+#include <vector>
+#include "HashTable.h"
+#include "IpAddress.h"
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+/*
+ * Descripción:
+ *      Convierte los valores de una tabla hash a registros de tamaño fijo para guardarlos en
+ *      una imagen (HashTableImage) y los reconstruye al leerla. Los registros no pueden tener
+ *      apuntadores: el texto variable se agrega a strings y el registro guarda su
+ *      desplazamiento y longitud. Esta versión copia tal cual los tipos trivialmente
+ *      copiables; ipAddress tiene su propia especialización. valid() revisa al abrir la
+ *      imagen que un registro leído del archivo sólo apunte dentro de strings.
+ *
+ * Complejidad temporal:
+ *      O(1) por valor, más la longitud de su texto.
+ */
+
+template <class T>
+struct HashImageCodec{
+    static_assert(std::is_trivially_copyable<T>::value, "HashImageCodec necesita una especializacion para este tipo");
+    typedef T Record;
+
+    static Record encode(T &value, std::string &){
+        return value;
+    }
+
+    static T decode(const Record &record, const char *){
+        return record;
+    }
+
+    static bool valid(const Record &, std::uint64_t){
+        return true;
+    }
+};
+
+template <>
+struct HashImageCodec<ipAddress>{
+    struct Record{
+        std::uint32_t textOffset;
+        std::uint32_t textLength;
+        std::int32_t index;
+        std::int32_t degreeIn;
+        std::int32_t degreeOut;
+    };
+
+    static Record encode(ipAddress &value, std::string &strings){
+        std::string text = value.getIp();
+        Record record;
+        record.textOffset = (std::uint32_t)strings.size();
+        record.textLength = (std::uint32_t)text.size();
+        record.index = value.getIpIndex();
+        record.degreeIn = value.getDegreeIn();
+        record.degreeOut = value.getDegreeOut();
+        strings += text;
+        return record;
+    }
+
+    static ipAddress decode(const Record &record, const char *strings){
+        ipAddress value(std::string(strings + record.textOffset, record.textLength), record.index);
+        value.setDegreeIn(record.degreeIn);
+        value.setDegreeOut(record.degreeOut);
+        return value;
+    }
+
+    static bool valid(const Record &record, std::uint64_t stringBytes){
+        return (std::uint64_t)record.textOffset + record.textLength <= stringBytes;
+    }
+};
+
+// Secciones de la imagen, en el orden en que se escriben.
+enum HashImageSection{
+    HASH_IMAGE_STATUS,
+    HASH_IMAGE_KEYS,
+    HASH_IMAGE_RECORDS,
+    HASH_IMAGE_OVERFLOW_OFFSETS,
+    HASH_IMAGE_OVERFLOW_CELLS,
+    HASH_IMAGE_STRINGS,
+    NUM_HASH_IMAGE_SECTIONS
+};
+
+/*
+ * Descripción:
+ *      Encabezado de la imagen. Guarda los nombres de las políticas Hasher y Sizing con las
+ *      que se calcularon las celdas, el tamaño del registro del codec y, como el snapshot del
+ *      grafo, el tamaño y la fecha del archivo de origen para descartar imágenes viejas.
+ */
+
+struct HashImageHeader{
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t capacity;
+    std::uint32_t numElements;
+    std::int32_t numCollisions;
+    std::uint32_t recordSize;
+    std::uint32_t overflowCount;
+    char hasher[16];
+    char sizing[16];
+    std::uint64_t stringBytes;
+    std::uint64_t sourceSize;
+    std::int64_t sourceTime;
+    std::uint64_t offsets[NUM_HASH_IMAGE_SECTIONS];
+    std::uint64_t sizes[NUM_HASH_IMAGE_SECTIONS];
+};
+
+/*
+ * Descripción:
+ *      Imagen en disco de una HashTable<unsigned int, T, Hasher, Sizing> que se mapea en
+ *      memoria de sólo lectura y se consulta sin reconstruir la tabla. Conserva la
+ *      organización de HashTable (cada elemento en la misma celda, estado 0, 1 o 2 por celda)
+ *      pero reemplaza el std::vector de desbordamiento de cada nodo por dos arreglos: la
+ *      lista de la celda c son las celdas overflowCells[overflowOffsets[c]] hasta
+ *      overflowCells[overflowOffsets[c + 1] - 1]. Todas las referencias son índices y
+ *      desplazamientos desde el inicio del archivo, así que la imagen es reubicable: varios
+ *      procesos pueden mapear el mismo archivo en direcciones distintas y compartir sus páginas.
+ *
+ *      Las funciones hash con llave secreta (KeyedHash) cambian de llave en cada proceso, así
+ *      que no se admiten.
+ */
+
+template <class T, class Hasher = IdentityHash, class Sizing = PrimeSizing>
+class HashTableImage{
+private:
+    static_assert(!IsKeyedHash<Hasher>::value, "HashTableImage no admite funciones hash con llave secreta");
+
+    typedef typename HashImageCodec<T>::Record Record;
+
+    const char *base;
+    std::size_t length;
+    bool mapped;
+    std::vector<char> buffer;
+    Hasher hasher;
+
+    // Apuntadores a las secciones dentro del mapeo; se calculan en open().
+    const std::uint8_t *status;
+    const std::uint32_t *keys;
+    const Record *records;
+    const std::uint32_t *overflowOffsets;
+    const std::int32_t *overflowCells;
+    const char *strings;
+
+    static const std::uint32_t VERSION = 1;
+    static const std::size_t ALIGNMENT = 64;
+
+    /*
+     * Descripción: expectedSizes()
+     *      Calcula el tamaño en bytes que debe tener cada sección según los conteos del
+     *      encabezado.
+     *
+     * Parámetros de entrada:
+     *      @header: encabezado de la imagen.
+     *
+     *      @sizes: arreglo donde se guardan los tamaños.
+     *
+     * Valor de retorno:
+     *      No retorna ningún valor.
+     *
+     * Complejidad temporal:
+     *      O(1)
+     */
+
+    static void expectedSizes(const HashImageHeader &header, std::uint64_t *sizes);
+
+    /*
+     * Descripción: validate()
+     *      Revisa la firma, la versión, las políticas, el tamaño del registro y que todas las
+     *      secciones queden alineadas dentro del archivo con el tamaño esperado. Después revisa
+     *      el contenido del que dependen find() y getDataAt() para no leer fuera del archivo:
+     *      cada estado es 0, 1 o 2, los desplazamientos de desbordamiento no decrecen y el
+     *      último es overflowCount, cada celda de desbordamiento está en [0, capacity) y el
+     *      texto de cada registro ocupado queda dentro de strings.
+     *
+     * Parámetros de entrada:
+     *      No posee parámetros de entrada.
+     *
+     * Valor de retorno:
+     *      true si la imagen es válida, false en caso contrario.
+     *
+     * Complejidad temporal:
+     *      O(n + m) donde n es el número de celdas y m el de elementos.
+     */
+
+    bool validate() const;
+
+public:
+
+    /*
+     * Descripción:
+     *      Constructor y destructor de la imagen. El destructor libera el mapeo de memoria.
+     *
+     * Parámetros de entrada:
+     *      No posee parámetros de entrada.
+     *
+     * Valor de retorno:
+     *      No retorna ningún valor.
+     *
+     * Complejidad temporal:
+     *      O(1)
+     */
+
+    HashTableImage();
+    ~HashTableImage();
+    HashTableImage(const HashTableImage &) = delete;
+    HashTableImage &operator=(const HashTableImage &) = delete;
+
+    /*
+     * Descripción: write()
+     *      Termina cualquier traslado pendiente de la tabla y escribe su imagen: el estado, la
+     *      llave y el registro de cada celda, las listas de desbordamiento como desplazamientos
+     *      y el texto de los registros. Cada sección inicia en un múltiplo de 64 bytes. Se
+     *      escribe en un archivo temporal que después se renombra.
+     *
+     * Parámetros de entrada:
+     *      @fileName: nombre del archivo de la imagen.
+     *
+     *      @meta: encabezado con el tamaño y la fecha del archivo de origen; lo demás se
+     *      calcula aquí.
+     *
+     *      @table: tabla de la que se escribe la imagen.
+     *
+     * Valor de retorno:
+     *      true si la imagen se escribió completa, false en caso contrario.
+     *
+     * Complejidad temporal:
+     *      O(n + m) donde n es el número de celdas y m el de elementos.
+     */
+
+    static bool write(const std::string &fileName, HashImageHeader meta, HashTable<unsigned int, T, Hasher, Sizing> &table);
+
+    /*
+     * Descripción: open()
+     *      Mapea una imagen en memoria de sólo lectura (o la lee completa en sistemas sin
+     *      mmap) y la valida. No se convierte ni se copia ningún dato.
+     *
+     * Parámetros de entrada:
+     *      @fileName: nombre del archivo de la imagen.
+     *
+     * Valor de retorno:
+     *      true si la imagen se abrió y es válida, false en caso contrario.
+     *
+     * Complejidad temporal:
+     *      O(n + m) por la validación, que recorre una vez los estados, los registros y las
+     *      listas de desbordamiento.
+     */
+
+    bool open(const std::string &fileName);
+
+    /*
+     * Descripción: close() / isOpen() / getHeader()
+     *      Liberan la imagen, indican si hay una abierta y devuelven su encabezado.
+     *
+     * Parámetros de entrada:
+     *      No posee parámetros de entrada.
+     *
+     * Valor de retorno:
+     *      isOpen() devuelve true si hay una imagen abierta; getHeader() su encabezado.
+     *
+     * Complejidad temporal:
+     *      O(1)
+     */
+
+    void close();
+    bool isOpen() const;
+    const HashImageHeader &getHeader() const;
+
+    /*
+     * Descripción: find()
+     *      Busca una llave igual que HashTable::find(): revisa su celda inicial y, si la celda
+     *      no está vacía, las celdas de su lista de desbordamiento.
+     *
+     * Parámetros de entrada:
+     *      @keyValue: llave buscada.
+     *
+     * Valor de retorno:
+     *      Celda de la llave (la misma que tenía en la tabla), o -1 si no está.
+     *
+     * Complejidad temporal:
+     *      O(1 + tamaño de la lista de desbordamiento).
+     */
+
+    int find(unsigned int keyValue) const;
+
+    /*
+     * Descripción: getDataAt()
+     *      Reconstruye con el codec el valor guardado en una celda.
+     *
+     * Parámetros de entrada:
+     *      @index: celda devuelta por find().
+     *
+     * Valor de retorno:
+     *      Valor de la celda.
+     *
+     * Complejidad temporal:
+     *      O(1), más la longitud del texto del valor.
+     */
+
+    T getDataAt(int index) const;
+
+    /*
+     * Descripción: getCapacity() / getNumElements() / getNumCollisions()
+     *      Devuelven los mismos valores que la tabla de la que se escribió la imagen.
+     *
+     * Parámetros de entrada:
+     *      No posee parámetros de entrada.
+     *
+     * Valor de retorno:
+     *      El valor correspondiente, o 0 si no hay imagen abierta.
+     *
+     * Complejidad temporal:
+     *      O(1)
+     */
+
+    int getCapacity() const;
+    int getNumElements() const;
+    int getNumCollisions() const;
+};
+
+/*
+ * Descripción: writeHashImage()
+ *      Escribe la imagen de una tabla con la interfaz de HashTable. Sólo HashTable con llaves
+ *      unsigned int y una función hash sin llave secreta tiene imagen; para las demás tablas
+ *      esta versión devuelve false y la sobrecarga de HashTable la escribe.
+ *
+ * Parámetros de entrada:
+ *      @table: tabla de la que se escribe la imagen.
+ *
+ *      @fileName: nombre del archivo de la imagen.
+ *
+ *      @meta: encabezado con la información del archivo de origen.
+ *
+ * Valor de retorno:
+ *      true si la imagen se escribió, false en caso contrario.
+ *
+ * Complejidad temporal:
+ *      O(1), u O(n + m) para HashTable.
+ */
+
+template <class Table>
+bool writeHashImage(Table &, const std::string &, const HashImageHeader &){
+    return false;
+}
+
+template <class T, class Hasher, class Sizing>
+bool writeHashImage(HashTable<unsigned int, T, Hasher, Sizing> &table, const std::string &fileName, const HashImageHeader &meta){
+
+    if constexpr (IsKeyedHash<Hasher>::value){
+        return false;
+    }
+
+    else{
+        return HashTableImage<T, Hasher, Sizing>::write(fileName, meta, table);
+    }
+}
+
+template <class T, class Hasher, class Sizing>
+HashTableImage<T, Hasher, Sizing>::HashTableImage(){
+    base = nullptr;
+    length = 0;
+    mapped = false;
+    status = nullptr;
+    keys = nullptr;
+    records = nullptr;
+    overflowOffsets = nullptr;
+    overflowCells = nullptr;
+    strings = nullptr;
+}
+
+template <class T, class Hasher, class Sizing>
+HashTableImage<T, Hasher, Sizing>::~HashTableImage(){
+    close();
+}
+
+template <class T, class Hasher, class Sizing>
+void HashTableImage<T, Hasher, Sizing>::expectedSizes(const HashImageHeader &header, std::uint64_t *sizes){
+    const std::uint64_t n = header.capacity;
+    sizes[HASH_IMAGE_STATUS] = n;
+    sizes[HASH_IMAGE_KEYS] = n * sizeof(std::uint32_t);
+    sizes[HASH_IMAGE_RECORDS] = n * sizeof(Record);
+    sizes[HASH_IMAGE_OVERFLOW_OFFSETS] = (n + 1) * sizeof(std::uint32_t);
+    sizes[HASH_IMAGE_OVERFLOW_CELLS] = (std::uint64_t)header.overflowCount * sizeof(std::int32_t);
+    sizes[HASH_IMAGE_STRINGS] = header.stringBytes;
+}
+
+template <class T, class Hasher, class Sizing>
+bool HashTableImage<T, Hasher, Sizing>::write(const std::string &fileName, HashImageHeader meta, HashTable<unsigned int, T, Hasher, Sizing> &table){
+
+    while (table.oldSize > 0){
+        table.migrateStep();
+    }
+
+    const int capacity = table.maxSize;
+    std::vector<std::uint8_t> cellStatus(capacity, 0);
+    std::vector<std::uint32_t> cellKeys(capacity, 0);
+    std::vector<Record> cellRecords(capacity);
+    std::vector<std::uint32_t> offsets(capacity + 1, 0);
+    std::vector<std::int32_t> cells;
+    std::string text;
+
+    for (int i = 0; i < capacity; i++){
+        HashNode<unsigned int, T> &node = table.table[i];
+        cellStatus[i] = (std::uint8_t)node.getStatus();
+        offsets[i] = (std::uint32_t)cells.size();
+
+        if (node.getStatus() == 1){
+            T value = node.getData();
+            cellKeys[i] = node.getKey();
+            cellRecords[i] = HashImageCodec<T>::encode(value, text);
+        }
+
+        else{
+            std::memset(&cellRecords[i], 0, sizeof(Record));
+        }
+
+        for (int k = 0; k < node.getOverflowSize(); k++){
+            cells.push_back(node.getOverflowAt(k));
+        }
+    }
+
+    offsets[capacity] = (std::uint32_t)cells.size();
+
+    std::memcpy(meta.magic, "BITHASH1", 8);
+    meta.version = VERSION;
+    meta.capacity = (std::uint32_t)capacity;
+    meta.numElements = (std::uint32_t)table.numElements;
+    meta.numCollisions = table.numCollisions;
+    meta.recordSize = (std::uint32_t)sizeof(Record);
+    meta.overflowCount = (std::uint32_t)cells.size();
+    std::memset(meta.hasher, 0, sizeof(meta.hasher));
+    std::memset(meta.sizing, 0, sizeof(meta.sizing));
+    std::strncpy(meta.hasher, Hasher::name(), sizeof(meta.hasher) - 1);
+    std::strncpy(meta.sizing, Sizing::name(), sizeof(meta.sizing) - 1);
+    meta.stringBytes = text.size();
+
+    const void *data[NUM_HASH_IMAGE_SECTIONS] = {
+        cellStatus.data(), cellKeys.data(), cellRecords.data(), offsets.data(), cells.data(), text.data()};
+    std::uint64_t offset = (sizeof(HashImageHeader) + ALIGNMENT - 1) / ALIGNMENT * ALIGNMENT;
+    expectedSizes(meta, meta.sizes);
+
+    for (int s = 0; s < NUM_HASH_IMAGE_SECTIONS; s++){
+        meta.offsets[s] = offset;
+        offset = (offset + meta.sizes[s] + ALIGNMENT - 1) / ALIGNMENT * ALIGNMENT;
+    }
+
+    // Se escribe en un archivo temporal y se renombra, para no dejar imágenes a medias.
+    std::string temporary = fileName + ".tmp";
+    std::ofstream file(temporary, std::ios::binary | std::ios::trunc);
+
+    if (!file.is_open()){
+        return false;
+    }
+
+    const char padding[ALIGNMENT] = {0};
+    std::uint64_t written = 0;
+    file.write(reinterpret_cast<const char *>(&meta), sizeof(meta));
+    written += sizeof(meta);
+
+    for (int s = 0; s < NUM_HASH_IMAGE_SECTIONS; s++){
+        file.write(padding, (std::streamsize)(meta.offsets[s] - written));
+        file.write(static_cast<const char *>(data[s]), (std::streamsize)meta.sizes[s]);
+        written = meta.offsets[s] + meta.sizes[s];
+    }
+
+    file.close();
+
+    if (!file.good()){
+        std::remove(temporary.c_str());
+        return false;
+    }
+
+    return std::rename(temporary.c_str(), fileName.c_str()) == 0;
+}
+
+template <class T, class Hasher, class Sizing>
+bool HashTableImage<T, Hasher, Sizing>::open(const std::string &fileName){
+    close();
+
+#if defined(__unix__) || defined(__APPLE__)
+    int fd = ::open(fileName.c_str(), O_RDONLY);
+
+    if (fd < 0){
+        return false;
+    }
+
+    struct stat info;
+
+    if (fstat(fd, &info) != 0 || (std::size_t)info.st_size < sizeof(HashImageHeader)){
+        ::close(fd);
+        return false;
+    }
+
+    void *address = mmap(nullptr, (std::size_t)info.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    ::close(fd);
+
+    if (address == MAP_FAILED){
+        return false;
+    }
+
+    base = static_cast<const char *>(address);
+    length = (std::size_t)info.st_size;
+    mapped = true;
+#else
+    std::ifstream file(fileName, std::ios::binary | std::ios::ate);
+
+    if (!file.is_open()){
+        return false;
+    }
+
+    std::streamsize size = file.tellg();
+
+    if (size < (std::streamsize)sizeof(HashImageHeader)){
+        return false;
+    }
+
+    buffer.resize((std::size_t)size);
+    file.seekg(0);
+    file.read(buffer.data(), size);
+    base = buffer.data();
+    length = buffer.size();
+#endif
+
+    if (!validate()){
+        close();
+        return false;
+    }
+
+    const HashImageHeader &header = getHeader();
+    status = reinterpret_cast<const std::uint8_t *>(base + header.offsets[HASH_IMAGE_STATUS]);
+    keys = reinterpret_cast<const std::uint32_t *>(base + header.offsets[HASH_IMAGE_KEYS]);
+    records = reinterpret_cast<const Record *>(base + header.offsets[HASH_IMAGE_RECORDS]);
+    overflowOffsets = reinterpret_cast<const std::uint32_t *>(base + header.offsets[HASH_IMAGE_OVERFLOW_OFFSETS]);
+    overflowCells = reinterpret_cast<const std::int32_t *>(base + header.offsets[HASH_IMAGE_OVERFLOW_CELLS]);
+    strings = base + header.offsets[HASH_IMAGE_STRINGS];
+    return true;
+}
+
+template <class T, class Hasher, class Sizing>
+bool HashTableImage<T, Hasher, Sizing>::validate() const{
+    const HashImageHeader &header = getHeader();
+
+    if (std::memcmp(header.magic, "BITHASH1", 8) != 0 || header.version != VERSION || header.recordSize != sizeof(Record) || header.capacity == 0 || header.capacity > INT_MAX){
+        return false;
+    }
+
+    if (std::strncmp(header.hasher, Hasher::name(), sizeof(header.hasher)) != 0 || std::strncmp(header.sizing, Sizing::name(), sizeof(header.sizing)) != 0){
+        return false;
+    }
+
+    std::uint64_t expected[NUM_HASH_IMAGE_SECTIONS];
+    expectedSizes(header, expected);
+
+    for (int s = 0; s < NUM_HASH_IMAGE_SECTIONS; s++){
+
+        // Se compara contra lo que resta del archivo para que offsets + sizes no se desborde.
+        if (header.sizes[s] != expected[s] || header.offsets[s] % ALIGNMENT != 0 || header.offsets[s] > length || header.sizes[s] > length - header.offsets[s]){
+            return false;
+        }
+    }
+
+    const std::uint8_t *cellStatus = reinterpret_cast<const std::uint8_t *>(base + header.offsets[HASH_IMAGE_STATUS]);
+    const Record *cellRecords = reinterpret_cast<const Record *>(base + header.offsets[HASH_IMAGE_RECORDS]);
+    const std::uint32_t *offsets = reinterpret_cast<const std::uint32_t *>(base + header.offsets[HASH_IMAGE_OVERFLOW_OFFSETS]);
+    const std::int32_t *cells = reinterpret_cast<const std::int32_t *>(base + header.offsets[HASH_IMAGE_OVERFLOW_CELLS]);
+
+    if (offsets[0] != 0 || offsets[header.capacity] != header.overflowCount){
+        return false;
+    }
+
+    for (std::uint32_t i = 0; i < header.capacity; i++){
+
+        if (cellStatus[i] > 2 || offsets[i] > offsets[i + 1]){
+            return false;
+        }
+
+        if (cellStatus[i] == 1 && !HashImageCodec<T>::valid(cellRecords[i], header.stringBytes)){
+            return false;
+        }
+    }
+
+    for (std::uint32_t k = 0; k < header.overflowCount; k++){
+
+        if (cells[k] < 0 || (std::uint32_t)cells[k] >= header.capacity){
+            return false;
+        }
+    }
+
+    return true;
+}
+
+template <class T, class Hasher, class Sizing>
+void HashTableImage<T, Hasher, Sizing>::close(){
+#if defined(__unix__) || defined(__APPLE__)
+    if (mapped && base != nullptr){
+        munmap(const_cast<char *>(base), length);
+    }
+#endif
+
+    buffer.clear();
+    base = nullptr;
+    length = 0;
+    mapped = false;
+}
+
+template <class T, class Hasher, class Sizing>
+bool HashTableImage<T, Hasher, Sizing>::isOpen() const{
+    return base != nullptr;
+}
+
+template <class T, class Hasher, class Sizing>
+const HashImageHeader &HashTableImage<T, Hasher, Sizing>::getHeader() const{
+    return *reinterpret_cast<const HashImageHeader *>(base);
+}
+
+template <class T, class Hasher, class Sizing>
+int HashTableImage<T, Hasher, Sizing>::find(unsigned int keyValue) const{
+
+    if (!isOpen()){
+        return -1;
+    }
+
+    int hashIndex = Sizing::home(hasher.hash((std::uint64_t)keyValue), (int)getHeader().capacity);
+
+    if (status[hashIndex] == 0){
+        return -1;
+    }
+
+    if (status[hashIndex] == 1 && keys[hashIndex] == keyValue){
+        return hashIndex;
+    }
+
+    for (std::uint32_t k = overflowOffsets[hashIndex]; k < overflowOffsets[hashIndex + 1]; k++){
+        int overflowIndex = overflowCells[k];
+
+        if (keys[overflowIndex] == keyValue){
+            return overflowIndex;
+        }
+    }
+
+    return -1;
+}
+
+template <class T, class Hasher, class Sizing>
+T HashTableImage<T, Hasher, Sizing>::getDataAt(int index) const{
+    return HashImageCodec<T>::decode(records[index], strings);
+}
+
+template <class T, class Hasher, class Sizing>
+int HashTableImage<T, Hasher, Sizing>::getCapacity() const{
+    return isOpen() ? (int)getHeader().capacity : 0;
+}
+
+template <class T, class Hasher, class Sizing>
+int HashTableImage<T, Hasher, Sizing>::getNumElements() const{
+    return isOpen() ? (int)getHeader().numElements : 0;
+}
+
+template <class T, class Hasher, class Sizing>
+int HashTableImage<T, Hasher, Sizing>::getNumCollisions() const{
+    return isOpen() ? getHeader().numCollisions : 0;
+}
+
+#endif // _HASH_TABLE_IMAGE_H_
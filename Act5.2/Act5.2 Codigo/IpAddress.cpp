@@ -1,4 +1,9 @@
 #include "IpAddress.h"
+#include <cstring>
+
+#if defined(__SSE2__) && !defined(IPADDRESS_NO_SIMD)
+#include <emmintrin.h>
+#endif
 
 ipAddress::ipAddress(){
     ipString = "0.0.0.0";
@@ -10,41 +15,186 @@ ipAddress::ipAddress(){
 }
 
 ipAddress::ipAddress(std::string _ip, int idx){
-    ipString = _ip;
+    ipString.assign(_ip.data(), _ip.size());
     ipIndex = idx;
     degreeIn = 0;
     degreeOut = 0;
     showAccessedIp = false;
+    ipValue = 0;
+
+    // Se toleran espacios alrededor de la dirección, como los que deja la bitácora.
+    std::string_view text(ipString);
+
+    while (!text.empty() && (text.front() == ' ' || text.front() == '\t')){
+        text.remove_prefix(1);
+    }
+
+    while (!text.empty() && (text.back() == ' ' || text.back() == '\t' || text.back() == '\r')){
+        text.remove_suffix(1);
+    }
+
+    std::uint32_t parsed = 0;
+    IpParseError error = parse(text, parsed);
+
+    if (error == IpParseError::None){
+        ipValue = parsed;
+    }
+
+    else{
+        std::cerr << "Error: " << "Direccion IP no valida (" << parseErrorMessage(error) << ")." << std::endl;
+    }
+}
 
-    int posInit = 0;
-    int posFound = 0;
-    std::string splitted;
-    std::vector<std::string> results;
+IpParseError ipAddress::parse(std::string_view text, std::uint32_t &result){
 
-    while (posFound >= 0){
-        posFound = ipString.find(".", posInit);
-        splitted = ipString.substr(posInit, posFound - posInit);
-        posInit = posFound + 1;
-        results.push_back(splitted);
+    if (text.empty()){
+        return IpParseError::Empty;
     }
 
-    try{
-        int partA = std::stoi(results[0]);
-        int partB = std::stoi(results[1]);
-        int partC = std::stoi(results[2]);
-        int partD = std::stoi(results[3]);
-        
-        ipValue = partA * (pow(256, 3)) + partB * (pow(256, 2)) + partC * (pow(256, 1)) + partD;
+    if (text.size() > 15){
+        return IpParseError::TooLong;
     }
 
-    catch (const std::exception &e){
-        std::cerr << "Error: " << "Direccion IP no valida." << std::endl;
+#if defined(__SSE2__) && !defined(IPADDRESS_NO_SIMD)
+    return parseSimd(text, result);
+#else
+    return parseScalar(text, result);
+#endif
+}
+
+IpParseError ipAddress::parseScalar(std::string_view text, std::uint32_t &result){
+    int numDots = 0;
+
+    for (char c : text){
+
+        if (c == '.'){
+            numDots++;
+        }
+
+        else if ((unsigned char)(c - '0') > 9){
+            return IpParseError::InvalidCharacter;
+        }
+    }
+
+    if (numDots != 3){
+        return (numDots < 3) ? IpParseError::MissingOctet : IpParseError::InvalidCharacter;
+    }
+
+    std::uint32_t value = 0;
+    std::uint32_t part = 0;
+    int length = 0;
+
+    for (std::size_t pos = 0; pos <= text.size(); pos++){
+
+        if (pos == text.size() || text[pos] == '.'){
+
+            if (length < 1){
+                return IpParseError::MissingOctet;
+            }
+
+            if (length > 3 || part > 255){
+                return IpParseError::OctetOutOfRange;
+            }
+
+            value = (value << 8) | part;
+            part = 0;
+            length = 0;
+        }
+
+        else{
+            part = (length < 3) ? part * 10 + (std::uint32_t)(text[pos] - '0') : part;
+            length++;
+        }
+    }
+
+    result = value;
+    return IpParseError::None;
+}
+
+#if defined(__SSE2__) && !defined(IPADDRESS_NO_SIMD)
+
+IpParseError ipAddress::parseSimd(std::string_view text, std::uint32_t &result){
+    alignas(16) char buffer[16] = {0};
+    std::memcpy(buffer, text.data(), text.size());
+
+    const unsigned int validMask = (1u << text.size()) - 1u;
+    __m128i block = _mm_load_si128(reinterpret_cast<const __m128i *>(buffer));
+    __m128i shifted = _mm_sub_epi8(block, _mm_set1_epi8('0'));
+    __m128i isDigit = _mm_cmpeq_epi8(_mm_min_epu8(shifted, _mm_set1_epi8(9)), shifted);
+    unsigned int dots = (unsigned int)_mm_movemask_epi8(_mm_cmpeq_epi8(block, _mm_set1_epi8('.'))) & validMask;
+    unsigned int digits = (unsigned int)_mm_movemask_epi8(isDigit) & validMask;
+
+    if ((dots | digits) != validMask){
+        return IpParseError::InvalidCharacter;
+    }
+
+    if (__builtin_popcount(dots) != 3){
+        return (__builtin_popcount(dots) < 3) ? IpParseError::MissingOctet : IpParseError::InvalidCharacter;
+    }
+
+    // Límites de los cuatro octetos: [bounds[k] + 1, bounds[k + 1]).
+    int bounds[5];
+    bounds[0] = -1;
+    bounds[1] = __builtin_ctz(dots);
+    dots &= dots - 1;
+    bounds[2] = __builtin_ctz(dots);
+    dots &= dots - 1;
+    bounds[3] = __builtin_ctz(dots);
+    bounds[4] = (int)text.size();
+
+    std::uint32_t value = 0;
+
+    for (int octet = 0; octet < 4; octet++){
+        int start = bounds[octet] + 1;
+        int length = bounds[octet + 1] - start;
+
+        if (length < 1){
+            return IpParseError::MissingOctet;
+        }
+
+        if (length > 3){
+            return IpParseError::OctetOutOfRange;
+        }
+
+        std::uint32_t part = (std::uint32_t)(buffer[start] - '0');
+        part = (length > 1) ? part * 10 + (std::uint32_t)(buffer[start + 1] - '0') : part;
+        part = (length > 2) ? part * 10 + (std::uint32_t)(buffer[start + 2] - '0') : part;
+
+        if (part > 255){
+            return IpParseError::OctetOutOfRange;
+        }
+
+        value = (value << 8) | part;
+    }
+
+    result = value;
+    return IpParseError::None;
+}
+
+#endif
+
+const char *ipAddress::parseErrorMessage(IpParseError error){
+
+    switch (error){
+        case IpParseError::None:
+            return "sin error";
+        case IpParseError::Empty:
+            return "cadena vacia";
+        case IpParseError::TooLong:
+            return "cadena demasiado larga";
+        case IpParseError::InvalidCharacter:
+            return "caracter invalido";
+        case IpParseError::MissingOctet:
+            return "faltan octetos";
+        case IpParseError::OctetOutOfRange:
+            return "octeto fuera de rango";
     }
 
+    return "error desconocido";
 }
 
 std::string ipAddress::getIp(){
-    return ipString;
+    return std::string(ipString.data(), ipString.size());
 }
 
 unsigned int ipAddress::getIpValue(){
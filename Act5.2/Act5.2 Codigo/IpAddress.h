@@ -2,19 +2,60 @@
 #define _IPADDRESS_H_
 
 #include <cmath>
+#include <cstdint>
 #include <iostream>
+#include <string>
+#include <string_view>
 #include <vector>
 #include "MaxHeap.h"
+#include "MemoryTracker.h"
+
+// Resultado de ipAddress::parse(): None indica que la dirección es válida.
+enum class IpParseError{
+    None,
+    Empty,
+    TooLong,
+    InvalidCharacter,
+    MissingOctet,
+    OctetOutOfRange
+};
+
+// Cadena cuyas reservas de memoria se atribuyen a los registros de la bitácora.
+typedef std::basic_string<char, std::char_traits<char>, TrackingAllocator<char, MemoryTag::Records>> CadenaIp;
 
 class ipAddress{
 private:
-    std::string ipString;
+    CadenaIp ipString;
     int ipIndex;
     int value;
     unsigned int ipValue;
     int degreeIn; 
     int degreeOut; 
 
+    /*
+     * Descripción: parseScalar() / parseSimd()
+     *      Implementaciones de parse(). parseScalar() recorre la cadena carácter por carácter;
+     *      parseSimd() copia la cadena a un bloque de 16 bytes y, con instrucciones SSE2, obtiene
+     *      en una sola comparación las posiciones de los puntos y la validez de los dígitos, de
+     *      modo que sólo quedan por convertir los octetos ya delimitados.
+     *
+     * Parámetros de entrada:
+     *      @text: dirección IP sin espacios, de 1 a 15 caracteres.
+     *
+     *      @result: referencia donde se guarda el valor de la dirección.
+     *
+     * Valor de retorno:
+     *      Código de error del análisis.
+     *
+     * Complejidad Temporal:
+     *      O(1)
+     */
+
+    static IpParseError parseScalar(std::string_view text, std::uint32_t &result);
+#if defined(__SSE2__) && !defined(IPADDRESS_NO_SIMD)
+    static IpParseError parseSimd(std::string_view text, std::uint32_t &result);
+#endif
+
 public:
     /*
      * Descripción:
@@ -51,11 +92,50 @@ public:
      *      No retorna ningún valor.
      *
      * Complejidad Temporal:
-     *      O(n) donde n es el número de octetos en la dirección IP
+     *      O(n) donde n es la longitud de la cadena, por la copia de _ip; la conversión
+     *      se realiza con parse().
      */
 
     ipAddress(std::string _ip, int idx);
 
+    /*
+     * Descripción: parse()
+     *      Convierte una dirección IPv4 en formato "A.B.C.D" a su valor entero sin signo
+     *      (A * 256^3 + B * 256^2 + C * 256 + D) sin reservar memoria. Cada octeto debe tener
+     *      de 1 a 3 dígitos y valer a lo más 255. Si el procesador soporta SSE2 se usa la ruta
+     *      vectorial; al compilar con -DIPADDRESS_NO_SIMD se usa siempre la ruta escalar.
+     *
+     * Parámetros de entrada:
+     *      @text: vista de la cadena con la dirección IP, sin espacios.
+     *
+     *      @result: referencia donde se guarda el valor de la dirección. Sólo se modifica si
+     *      la dirección es válida.
+     *
+     * Valor de retorno:
+     *      IpParseError::None si la dirección es válida o el código del error encontrado.
+     *
+     * Complejidad Temporal:
+     *      O(1), ya que la dirección tiene a lo más 15 caracteres.
+     */
+
+    static IpParseError parse(std::string_view text, std::uint32_t &result);
+
+    /*
+     * Descripción: parseErrorMessage()
+     *      Devuelve una descripción del código de error de parse().
+     *
+     * Parámetros de entrada:
+     *      @error: código de error.
+     *
+     * Valor de retorno:
+     *      Cadena constante con la descripción del error.
+     *
+     * Complejidad Temporal:
+     *      O(1)
+     */
+
+    static const char *parseErrorMessage(IpParseError error);
+
     /*
      * Descripción: getIp()
      *      Método que devuelve la dirección IP almacenada en formato de cadena.
@@ -0,0 +1,284 @@
+#ifndef _IP_INDEX_MAP_H_
+#define _IP_INDEX_MAP_H_
+
+#include <cstdint>
+#include <vector>
+#include "MemoryTracker.h"
+
+/*
+ * Descripción:
+ *      Diccionario plano que asocia el valor entero de una dirección IPv4 con un índice
+ *      (por ejemplo, la posición del nodo en el vector ordenado de direcciones). Usa
+ *      direccionamiento abierto con sondeo lineal sobre un arreglo de tamaño potencia de
+ *      dos, de modo que cada búsqueda es un cálculo de hash y, en promedio, una o dos
+ *      lecturas contiguas de memoria, sin reservar memoria por consulta.
+ *
+ * Complejidad temporal:
+ *      O(1) en promedio por inserción y búsqueda.
+ */
+
+class IpIndexMap{
+private:
+    std::vector<std::uint32_t, TrackingAllocator<std::uint32_t, MemoryTag::HashTable>> keys;
+    std::vector<int, TrackingAllocator<int, MemoryTag::HashTable>> values;
+    std::uint32_t mask;
+    int shift;
+    int numElements;
+
+    /*
+     * Descripción: slotOf()
+     *      Calcula la casilla inicial de una llave con hashing de Fibonacci: se multiplica
+     *      por 2^32 / φ y se conservan los bits más altos, que mezclan todos los octetos.
+     *
+     * Parámetros de entrada:
+     *      @key: valor entero de la dirección IP.
+     *
+     * Valor de retorno:
+     *      Casilla inicial dentro del arreglo.
+     *
+     * Complejidad temporal:
+     *      O(1)
+     */
+
+    std::uint32_t slotOf(std::uint32_t key) const;
+
+public:
+
+    /*
+     * Descripción:
+     *      Constructor del diccionario. Crea un diccionario vacío sin casillas.
+     *
+     * Parámetros de entrada:
+     *      No posee parámetros de entrada.
+     *
+     * Valor de retorno:
+     *      No retorna ningún valor.
+     *
+     * Complejidad temporal:
+     *      O(1)
+     */
+
+    IpIndexMap();
+
+    /*
+     * Descripción: reserve()
+     *      Vacía el diccionario y reserva casillas para el número de elementos indicado,
+     *      manteniendo el factor de carga en 0.5 o menos.
+     *
+     * Parámetros de entrada:
+     *      @expected: número de elementos que se van a insertar.
+     *
+     * Valor de retorno:
+     *      No retorna ningún valor.
+     *
+     * Complejidad temporal:
+     *      O(n) donde n es el número de casillas reservadas.
+     */
+
+    void reserve(int expected);
+
+    /*
+     * Descripción: insert()
+     *      Inserta la pareja (llave, índice). Si la llave ya existe conserva el primer
+     *      índice insertado.
+     *
+     * Parámetros de entrada:
+     *      @key: valor entero de la dirección IP.
+     *
+     *      @index: índice asociado a la dirección.
+     *
+     * Valor de retorno:
+     *      true si la llave se insertó, false si ya existía.
+     *
+     * Complejidad temporal:
+     *      O(1) en promedio.
+     */
+
+    bool insert(std::uint32_t key, int index);
+
+    /*
+     * Descripción: find()
+     *      Busca el índice asociado a una llave.
+     *
+     * Parámetros de entrada:
+     *      @key: valor entero de la dirección IP.
+     *
+     * Valor de retorno:
+     *      El índice asociado, o -1 si la llave no existe.
+     *
+     * Complejidad temporal:
+     *      O(1) en promedio.
+     */
+
+    int find(std::uint32_t key) const;
+
+    /*
+     * Descripción: size()
+     *      Devuelve el número de llaves almacenadas.
+     *
+     * Parámetros de entrada:
+     *      No posee parámetros de entrada.
+     *
+     * Valor de retorno:
+     *      Número de llaves.
+     *
+     * Complejidad temporal:
+     *      O(1)
+     */
+
+    int size() const;
+
+    /*
+     * Descripción: getKeyData() / getValueData() / getCapacity() / getShift()
+     *      Exponen el arreglo de llaves, el arreglo de índices, el número de casillas y el
+     *      desplazamiento del hash, para guardar el diccionario tal cual en un snapshot.
+     *
+     * Parámetros de entrada:
+     *      No posee parámetros de entrada.
+     *
+     * Valor de retorno:
+     *      Apuntador o valor correspondiente.
+     *
+     * Complejidad temporal:
+     *      O(1)
+     */
+
+    const std::uint32_t *getKeyData() const;
+    const int *getValueData() const;
+    std::uint32_t getCapacity() const;
+    int getShift() const;
+
+    /*
+     * Descripción: findIn()
+     *      Búsqueda sobre arreglos externos con la misma distribución que el diccionario
+     *      (por ejemplo, los de un snapshot mapeado en memoria).
+     *
+     * Parámetros de entrada:
+     *      @keys: arreglo de llaves.
+     *
+     *      @values: arreglo de índices; -1 marca una casilla vacía.
+     *
+     *      @capacity: número de casillas, potencia de dos.
+     *
+     *      @shift: desplazamiento del hash de Fibonacci.
+     *
+     *      @key: valor entero de la dirección IP.
+     *
+     * Valor de retorno:
+     *      El índice asociado, o -1 si la llave no existe.
+     *
+     * Complejidad temporal:
+     *      O(1) en promedio; a lo más O(capacity) sondeos aunque los arreglos estén dañados.
+     */
+
+    static int findIn(const std::uint32_t *keys, const int *values, std::uint32_t capacity, int shift, std::uint32_t key);
+};
+
+inline IpIndexMap::IpIndexMap(){
+    mask = 0;
+    shift = 32;
+    numElements = 0;
+}
+
+inline void IpIndexMap::reserve(int expected){
+    std::uint32_t capacity = 16;
+    int bits = 4;
+
+    while (capacity < 2 * (std::uint32_t)(expected > 0 ? expected : 1)){
+        capacity <<= 1;
+        bits++;
+    }
+
+    keys.assign(capacity, 0);
+    values.assign(capacity, -1);
+    mask = capacity - 1;
+    shift = 32 - bits;
+    numElements = 0;
+}
+
+inline std::uint32_t IpIndexMap::slotOf(std::uint32_t key) const{
+    return (std::uint32_t)(key * 2654435769u) >> shift;
+}
+
+inline bool IpIndexMap::insert(std::uint32_t key, int index){
+
+    if (values.empty() || 2 * (numElements + 1) > (int)values.size()){
+        // Crecer conserva el factor de carga; se reinsertan todas las parejas.
+        std::vector<std::uint32_t, TrackingAllocator<std::uint32_t, MemoryTag::HashTable>> oldKeys;
+        std::vector<int, TrackingAllocator<int, MemoryTag::HashTable>> oldValues;
+        oldKeys.swap(keys);
+        oldValues.swap(values);
+        reserve(numElements + 1 > 8 ? 2 * (numElements + 1) : 8);
+
+        for (std::size_t k = 0; k < oldValues.size(); k++){
+
+            if (oldValues[k] != -1){
+                insert(oldKeys[k], oldValues[k]);
+            }
+        }
+    }
+
+    std::uint32_t slot = slotOf(key);
+
+    while (values[slot] != -1){
+
+        if (keys[slot] == key){
+            return false;
+        }
+
+        slot = (slot + 1) & mask;
+    }
+
+    keys[slot] = key;
+    values[slot] = index;
+    numElements++;
+    return true;
+}
+
+inline int IpIndexMap::find(std::uint32_t key) const{
+    return findIn(keys.data(), values.data(), (std::uint32_t)values.size(), shift, key);
+}
+
+inline int IpIndexMap::findIn(const std::uint32_t *keys, const int *values, std::uint32_t capacity, int shift, std::uint32_t key){
+
+    if (capacity == 0){
+        return -1;
+    }
+
+    std::uint32_t mask = capacity - 1;
+    std::uint32_t slot = ((std::uint32_t)(key * 2654435769u) >> shift) & mask;
+
+    // A lo más capacity sondeos, aunque los arreglos no tengan ninguna casilla vacía.
+    for (std::uint32_t probe = 0; probe < capacity && values[slot] != -1; probe++){
+
+        if (keys[slot] == key){
+            return values[slot];
+        }
+
+        slot = (slot + 1) & mask;
+    }
+
+    return -1;
+}
+
+inline int IpIndexMap::size() const{
+    return numElements;
+}
+
+inline const std::uint32_t *IpIndexMap::getKeyData() const{
+    return keys.data();
+}
+
+inline const int *IpIndexMap::getValueData() const{
+    return values.data();
+}
+
+inline std::uint32_t IpIndexMap::getCapacity() const{
+    return (std::uint32_t)values.size();
+}
+
+inline int IpIndexMap::getShift() const{
+    return shift;
+}
+
+#endif // _IP_INDEX_MAP_H_
@@ -6,11 +6,12 @@
 #include <vector>
 #include <fstream>
 #include <algorithm>
+#include "MemoryTracker.h"
 
 template <class T>
 class MaxHeap{
 private:
-    std::vector<T> data;
+    std::vector<T, TrackingAllocator<T, MemoryTag::Heap>> data;
     int maxCapacity;
     int currentSize;
 
@@ -85,7 +86,8 @@ private:
      *      garantizar que la propiedad del Max Heap se mantenga.
      *
      * Parámetros de entrada:
-     *      @vectorRegistros: Una referencia al vector que se va a ordenar.
+     *      @vectorRegistros: Una referencia al vector que se va a ordenar. Puede
+     *      ser el vector interno del heap o un std::vector externo (heapSort).
      *
      *      @n: El tamaño del heap (o subárbol del heap) en el que se va a
      *      aplicar la operación de heapify.
@@ -99,7 +101,8 @@ private:
      *      O(log n)
      */
 
-    void heapifyHelper(std::vector<T> &vectorRegistros, int n, int k);
+    template <class Container>
+    void heapifyHelper(Container &vectorRegistros, int n, int k);
 
     /*
      * Descripción: heapifyPop()
@@ -438,7 +441,8 @@ void MaxHeap<T>::heapSort(std::vector<T> &vectorRegistros, int n){
 }
 
 template <class T>
-void MaxHeap<T>::heapifyHelper(std::vector<T> &vectorRegistros, int n, int k){
+template <class Container>
+void MaxHeap<T>::heapifyHelper(Container &vectorRegistros, int n, int k){
     int largest = k;
     int left = 2 * k + 1;
     int right = 2 * k + 2;
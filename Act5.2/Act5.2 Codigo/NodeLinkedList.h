@@ -1,6 +1,10 @@
 #ifndef _NODELINKEDLIST_H_
 #define _NODELINKEDLIST_H_
 
+#include <cstddef>
+#include <new>
+#include "MemoryTracker.h"
+
 template <class T>
 class NodeLinkedList{
 public:
@@ -44,6 +48,30 @@ public:
      */
 
     NodeLinkedList(T value);
+
+    /*
+     * Descripción: operator new() / operator delete()
+     *      Reservan y liberan la memoria de cada nodo reportándola al MemoryTracker.
+     *      En este programa las listas enlazadas solo se usan como listas de
+     *      adyacencia del grafo, por lo que los nodos se atribuyen a ese subsistema.
+     *      La versión sin tamaño es la que usa delete y libera sizeof(NodeLinkedList<T>),
+     *      el mismo tamaño que recibe operator new().
+     *
+     * Parámetros de entrada:
+     *      @size: número de bytes del nodo.
+     *
+     *      @p: puntero al nodo que se libera.
+     *
+     * Valor de retorno:
+     *      operator new() devuelve el puntero a la memoria reservada.
+     *
+     * Complejidad Temporal:
+     *      O(1)
+     */
+
+    static void *operator new(std::size_t size);
+    static void operator delete(void *p);
+    static void operator delete(void *p, std::size_t size);
 };
 
 template <class T>
@@ -52,4 +80,23 @@ NodeLinkedList<T>::NodeLinkedList() : data{}, next{nullptr} {}
 template <class T>
 NodeLinkedList<T>::NodeLinkedList(T value) : data{value}, next{nullptr} {}
 
+template <class T>
+void *NodeLinkedList<T>::operator new(std::size_t size){
+    void *p = ::operator new(size);
+    MemoryTracker::getInstance().allocated(MemoryTag::Adjacency, size);
+    return p;
+}
+
+template <class T>
+void NodeLinkedList<T>::operator delete(void *p){
+    MemoryTracker::getInstance().released(MemoryTag::Adjacency, sizeof(NodeLinkedList<T>));
+    ::operator delete(p);
+}
+
+template <class T>
+void NodeLinkedList<T>::operator delete(void *p, std::size_t size){
+    MemoryTracker::getInstance().released(MemoryTag::Adjacency, size);
+    ::operator delete(p);
+}
+
 #endif // _NODELINKEDLIST_H_
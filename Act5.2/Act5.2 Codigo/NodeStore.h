@@ -0,0 +1,339 @@
+#ifndef _NODE_STORE_H_
+#define _NODE_STORE_H_
+
+#include <algorithm>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "IpAddress.h"
+#include "MemoryTracker.h"
+#include "ThreadPool.h"
+
+/*
+ * Descripción:
+ *      Almacén de los nodos del grafo en formato de estructura de arreglos (SoA). En lugar
+ *      de un vector de objetos ipAddress, cada atributo ocupa su propio arreglo ordenado por
+ *      valor de IP: el valor entero de la IP, el índice del nodo en la bitácora, los grados
+ *      de entrada y de salida, y el texto de la IP dentro de un único arreglo de caracteres.
+ *      Las búsquedas sólo leen el arreglo de valores y los conteos de grado sólo sus propios
+ *      arreglos. Cuando se necesita un objeto ipAddress (para la tabla hash o para imprimir)
+ *      se construye a partir de las columnas con materialize().
+ *
+ * Complejidad temporal:
+ *      O(1) por acceso a una columna.
+ */
+
+class NodeStore{
+private:
+    std::vector<std::uint32_t, TrackingAllocator<std::uint32_t, MemoryTag::Records>> ipValues;
+    std::vector<int, TrackingAllocator<int, MemoryTag::Records>> nodeIds;
+    std::vector<int, TrackingAllocator<int, MemoryTag::Records>> degreeIn;
+    std::vector<int, TrackingAllocator<int, MemoryTag::Records>> degreeOut;
+    // Texto de la IP en la posición k: [stringOffsets[k], stringOffsets[k + 1]) de arena.
+    std::vector<char, TrackingAllocator<char, MemoryTag::Records>> arena;
+    std::vector<std::uint32_t, TrackingAllocator<std::uint32_t, MemoryTag::Records>> stringOffsets;
+
+public:
+
+    /*
+     * Descripción: build()
+     *      Construye el almacén a partir de las líneas de la sección de nodos. Las direcciones
+     *      se convierten en paralelo con ipAddress::parse(), después se ordena una permutación
+     *      de los nodos por valor de IP (y por índice en la bitácora en caso de empate) y se
+     *      llenan las columnas en ese orden. Los grados inician en cero.
+     *
+     * Parámetros de entrada:
+     *      @lines: líneas de la sección de nodos, en el orden de la bitácora.
+     *
+     * Valor de retorno:
+     *      No retorna ningún valor.
+     *
+     * Complejidad temporal:
+     *      O(n log n) donde n es el número de nodos.
+     */
+
+    void build(const std::vector<std::string> &lines);
+
+    /*
+     * Descripción: size()
+     *      Devuelve el número de nodos almacenados.
+     *
+     * Parámetros de entrada:
+     *      No posee parámetros de entrada.
+     *
+     * Valor de retorno:
+     *      Número de nodos.
+     *
+     * Complejidad temporal:
+     *      O(1)
+     */
+
+    int size() const;
+
+    /*
+     * Descripción: getIpValue() / getNodeId() / getIpString() / getDegreeIn() / getDegreeOut()
+     *      Devuelven una columna del nodo que ocupa la posición indicada en el orden por IP.
+     *
+     * Parámetros de entrada:
+     *      @pos: posición del nodo en el orden por valor de IP.
+     *
+     * Valor de retorno:
+     *      Valor de la columna correspondiente.
+     *
+     * Complejidad temporal:
+     *      O(1)
+     */
+
+    std::uint32_t getIpValue(int pos) const;
+    int getNodeId(int pos) const;
+    std::string_view getIpString(int pos) const;
+    int getDegreeIn(int pos) const;
+    int getDegreeOut(int pos) const;
+
+    /*
+     * Descripción: setDegrees()
+     *      Establece los grados del nodo en la posición indicada.
+     *
+     * Parámetros de entrada:
+     *      @pos: posición del nodo en el orden por valor de IP.
+     *
+     *      @in: grado de entrada.
+     *
+     *      @out: grado de salida.
+     *
+     * Valor de retorno:
+     *      No retorna ningún valor.
+     *
+     * Complejidad temporal:
+     *      O(1)
+     */
+
+    void setDegrees(int pos, int in, int out);
+
+    /*
+     * Descripción: find()
+     *      Búsqueda binaria sobre la columna de valores de IP.
+     *
+     * Parámetros de entrada:
+     *      @value: valor entero de la dirección IP.
+     *
+     * Valor de retorno:
+     *      Posición de la dirección, o -1 si no existe.
+     *
+     * Complejidad temporal:
+     *      O(log n)
+     */
+
+    int find(std::uint32_t value) const;
+
+    /*
+     * Descripción: materialize()
+     *      Construye un objeto ipAddress con el texto, el índice y los grados del nodo.
+     *
+     * Parámetros de entrada:
+     *      @pos: posición del nodo en el orden por valor de IP.
+     *
+     * Valor de retorno:
+     *      Objeto ipAddress equivalente al nodo.
+     *
+     * Complejidad temporal:
+     *      O(l) donde l es la longitud del texto de la IP.
+     */
+
+    ipAddress materialize(int pos) const;
+
+    /*
+     * Descripción: getIpValueData() / getNodeIdData() / getDegreeInData() / getDegreeOutData() /
+     *              getStringOffsetData() / getStringData()
+     *      Exponen cada columna como arreglo contiguo, para construir vistas de sólo lectura
+     *      o escribirlas en un snapshot.
+     *
+     * Parámetros de entrada:
+     *      No posee parámetros de entrada.
+     *
+     * Valor de retorno:
+     *      Apuntador al inicio de la columna.
+     *
+     * Complejidad temporal:
+     *      O(1)
+     */
+
+    const std::uint32_t *getIpValueData() const;
+    const int *getNodeIdData() const;
+    const int *getDegreeInData() const;
+    const int *getDegreeOutData() const;
+    const std::uint32_t *getStringOffsetData() const;
+    const char *getStringData() const;
+
+    /*
+     * Descripción: clear()
+     *      Libera todas las columnas.
+     *
+     * Parámetros de entrada:
+     *      No posee parámetros de entrada.
+     *
+     * Valor de retorno:
+     *      No retorna ningún valor.
+     *
+     * Complejidad temporal:
+     *      O(n)
+     */
+
+    void clear();
+};
+
+inline void NodeStore::build(const std::vector<std::string> &lines){
+    int n = (int)lines.size();
+    std::vector<std::uint32_t> parsedValues(n, 0);
+
+    parallelFor(0, n, 4096, [&lines, &parsedValues](int begin, int end){
+
+        for (int k = begin; k < end; k++){
+            std::string_view text(lines[k]);
+
+            while (!text.empty() && (text.front() == ' ' || text.front() == '\t')){
+                text.remove_prefix(1);
+            }
+
+            while (!text.empty() && (text.back() == ' ' || text.back() == '\t' || text.back() == '\r')){
+                text.remove_suffix(1);
+            }
+
+            IpParseError error = ipAddress::parse(text, parsedValues[k]);
+
+            if (error != IpParseError::None){
+                std::cerr << "Error: " << "Direccion IP no valida (" << ipAddress::parseErrorMessage(error) << ")." << std::endl;
+            }
+        }
+    });
+
+    std::vector<int> order(n);
+
+    for (int k = 0; k < n; k++){
+        order[k] = k;
+    }
+
+    std::sort(order.begin(), order.end(), [&parsedValues](int a, int b){
+        return parsedValues[a] < parsedValues[b] || (parsedValues[a] == parsedValues[b] && a < b);
+    });
+
+    ipValues.resize(n);
+    nodeIds.resize(n);
+    degreeIn.assign(n, 0);
+    degreeOut.assign(n, 0);
+    stringOffsets.resize(n + 1);
+    arena.clear();
+
+    std::size_t totalLength = 0;
+
+    for (const std::string &line : lines){
+        totalLength += line.size();
+    }
+
+    arena.reserve(totalLength);
+    stringOffsets[0] = 0;
+
+    for (int pos = 0; pos < n; pos++){
+        int id = order[pos];
+        ipValues[pos] = parsedValues[id];
+        nodeIds[pos] = id;
+        arena.insert(arena.end(), lines[id].begin(), lines[id].end());
+        stringOffsets[pos + 1] = (std::uint32_t)arena.size();
+    }
+}
+
+inline int NodeStore::size() const{
+    return (int)ipValues.size();
+}
+
+inline std::uint32_t NodeStore::getIpValue(int pos) const{
+    return ipValues[pos];
+}
+
+inline int NodeStore::getNodeId(int pos) const{
+    return nodeIds[pos];
+}
+
+inline std::string_view NodeStore::getIpString(int pos) const{
+    return std::string_view(arena.data() + stringOffsets[pos], stringOffsets[pos + 1] - stringOffsets[pos]);
+}
+
+inline int NodeStore::getDegreeIn(int pos) const{
+    return degreeIn[pos];
+}
+
+inline int NodeStore::getDegreeOut(int pos) const{
+    return degreeOut[pos];
+}
+
+inline void NodeStore::setDegrees(int pos, int in, int out){
+    degreeIn[pos] = in;
+    degreeOut[pos] = out;
+}
+
+inline int NodeStore::find(std::uint32_t value) const{
+    int low = 0;
+    int high = size() - 1;
+
+    while (low <= high){
+        int mid = low + (high - low) / 2;
+
+        if (ipValues[mid] == value){
+            return mid;
+        }
+
+        else if (value < ipValues[mid]){
+            high = mid - 1;
+        }
+
+        else{
+            low = mid + 1;
+        }
+    }
+
+    return -1;
+}
+
+inline ipAddress NodeStore::materialize(int pos) const{
+    ipAddress address(std::string(getIpString(pos)), nodeIds[pos]);
+    address.setDegreeIn(degreeIn[pos]);
+    address.setDegreeOut(degreeOut[pos]);
+    return address;
+}
+
+inline const std::uint32_t *NodeStore::getIpValueData() const{
+    return ipValues.data();
+}
+
+inline const int *NodeStore::getNodeIdData() const{
+    return nodeIds.data();
+}
+
+inline const int *NodeStore::getDegreeInData() const{
+    return degreeIn.data();
+}
+
+inline const int *NodeStore::getDegreeOutData() const{
+    return degreeOut.data();
+}
+
+inline const std::uint32_t *NodeStore::getStringOffsetData() const{
+    return stringOffsets.data();
+}
+
+inline const char *NodeStore::getStringData() const{
+    return arena.data();
+}
+
+inline void NodeStore::clear(){
+    ipValues.clear();
+    nodeIds.clear();
+    degreeIn.clear();
+    degreeOut.clear();
+    arena.clear();
+    stringOffsets.clear();
+}
+
+#endif // _NODE_STORE_H_
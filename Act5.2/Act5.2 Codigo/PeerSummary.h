@@ -0,0 +1,147 @@
+#ifndef _PEER_SUMMARY_H_
+#define _PEER_SUMMARY_H_
+
+#include <cstdio>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include "IpAddress.h"
+
+/*
+ * Descripción:
+ *      Fecha de una línea de la bitácora ("Mes Día HH:MM:SS") codificada como segundos desde
+ *      el 1 de enero a las 00:00:00, con meses de 31 días. No corresponde a un calendario
+ *      real, pero conserva el orden cronológico y se puede volver a escribir tal como aparece
+ *      en la bitácora. El valor -1 indica una fecha que no se pudo interpretar.
+ */
+
+const int LOG_TIME_DAY = 24 * 3600;
+const int LOG_TIME_MONTH = 31 * LOG_TIME_DAY;
+
+/*
+ * Descripción: parseLogTime()
+ *      Convierte los tres tokens de la fecha de una línea de la bitácora en segundos.
+ *
+ * Parámetros de entrada:
+ *      @month: abreviatura en inglés del mes ("Jan" ... "Dec").
+ *
+ *      @day: día del mes.
+ *
+ *      @time: hora en formato HH:MM:SS.
+ *
+ * Valor de retorno:
+ *      Segundos desde el inicio del año, o -1 si algún token no es válido.
+ *
+ * Complejidad temporal:
+ *      O(1)
+ */
+
+inline int parseLogTime(std::string_view month, std::string_view day, std::string_view time){
+    static const char *const months[12] = {"Jan", "Feb", "Mar", "Apr", "May", "Jun", "Jul", "Aug", "Sep", "Oct", "Nov", "Dec"};
+    int monthIndex = -1;
+
+    for (int k = 0; k < 12; k++){
+
+        if (month == months[k]){
+            monthIndex = k;
+        }
+    }
+
+    if (monthIndex == -1 || day.empty() || day.size() > 2 || time.size() != 8 || time[2] != ':' || time[5] != ':'){
+        return -1;
+    }
+
+    int dayNumber = 0;
+
+    for (char c : day){
+
+        if (c < '0' || c > '9'){
+            return -1;
+        }
+
+        dayNumber = dayNumber * 10 + (c - '0');
+    }
+
+    int fields[3] = {0, 0, 0};
+
+    for (int k = 0; k < 3; k++){
+        char high = time[3 * k];
+        char low = time[3 * k + 1];
+
+        if (high < '0' || high > '9' || low < '0' || low > '9'){
+            return -1;
+        }
+
+        fields[k] = (high - '0') * 10 + (low - '0');
+    }
+
+    if (dayNumber < 1 || dayNumber > 31 || fields[0] > 23 || fields[1] > 59 || fields[2] > 59){
+        return -1;
+    }
+
+    return monthIndex * LOG_TIME_MONTH + (dayNumber - 1) * LOG_TIME_DAY + fields[0] * 3600 + fields[1] * 60 + fields[2];
+}
+
+/*
+ * Descripción: formatLogTime()
+ *      Escribe una fecha codificada con parseLogTime() en el formato de la bitácora.
+ *
+ * Parámetros de entrada:
+ *      @seconds: fecha codificada.
+ *
+ * Valor de retorno:
+ *      Texto "Mes DD HH:MM:SS" (el día con dos dígitos, como en las bitácoras), o "?" si la
+ *      fecha no es válida.
+ *
+ * Complejidad temporal:
+ *      O(1)
+ */
+
+inline std::string formatLogTime(int seconds){
+    static const char *const months[12] = {"Jan", "Feb", "Mar", "Apr", "May", "Jun", "Jul", "Aug", "Sep", "Oct", "Nov", "Dec"};
+
+    if (seconds < 0 || seconds >= 12 * LOG_TIME_MONTH){
+        return "?";
+    }
+
+    int rest = seconds % LOG_TIME_DAY;
+    char buffer[32];
+    std::snprintf(buffer, sizeof(buffer), "%s %02d %02d:%02d:%02d", months[seconds / LOG_TIME_MONTH], (seconds % LOG_TIME_MONTH) / LOG_TIME_DAY + 1, rest / 3600, (rest / 60) % 60, rest % 60);
+    return std::string(buffer);
+}
+
+/*
+ * Descripción:
+ *      Renglón del resumen de una IP en el modo de aristas agregadas: una dirección vecina con
+ *      el número de conexiones entre ambas direcciones, la suma de sus pesos y la primera y
+ *      última fecha en que aparecen en la bitácora. Se compara por la dirección, igual que
+ *      ipAddress, para que el heap la ordene de la misma forma.
+ *
+ * Complejidad temporal:
+ *      O(1) por comparación.
+ */
+
+struct PeerSummary{
+    ipAddress address;
+    int hits;
+    int totalWeight;
+    int firstSeen;
+    int lastSeen;
+
+    PeerSummary() : hits(0), totalWeight(0), firstSeen(-1), lastSeen(-1) {}
+
+    bool operator<(const PeerSummary &other) const{
+        return address < other.address;
+    }
+
+    bool operator>(const PeerSummary &other) const{
+        return address > other.address;
+    }
+
+    friend std::ostream &operator<<(std::ostream &os, const PeerSummary &peer){
+        os << peer.address << "  conexiones: " << peer.hits << "  peso total: " << peer.totalWeight << "  primera: " << formatLogTime(peer.firstSeen) << "  ultima: " << formatLogTime(peer.lastSeen);
+        return os;
+    }
+};
+
+#endif // _PEER_SUMMARY_H_
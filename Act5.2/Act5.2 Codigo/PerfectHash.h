@@ -0,0 +1,436 @@
+#ifndef _PERFECT_HASH_H_
+#define _PERFECT_HASH_H_
+
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+#include "HashPolicies.h"
+#include "MemoryTracker.h"
+
+/*
+ * Descripción:
+ *      Función hash perfecta mínima para un conjunto fijo de llaves de 32 bits, construida con
+ *      el método de desplazamientos (CHD / PTHash): cada llave cae en una cubeta, con unas
+ *      BUCKET_LOAD llaves por cubeta en promedio, y cada cubeta guarda un piloto p tal que
+ *      casilla(llave) = rango(hash(llave) xor hash(p), m) no choca con ninguna otra llave. Las
+ *      cubetas se acomodan de la más grande a la más chica, probando pilotos 0, 1, 2, ...
+ *      hasta encontrar uno libre; los pilotos se guardan empacados con los bits justos para
+ *      el mayor de ellos.
+ *
+ *      Para que las últimas cubetas no necesiten pilotos enormes, el rango tiene m = n + n/32
+ *      casillas (factor de carga de 0.97). Las llaves que caen en las casillas sobrantes
+ *      [n, m) se reubican en los huecos de [0, n) con una tabla pequeña, también empacada,
+ *      así que la función sigue siendo mínima.
+ *
+ *      Como todos los pilotos se guardan con el ancho del mayor, y éste crece con el número
+ *      de cubetas, el tamaño por llave crece poco a poco con n: medido con getBitsPerKey()
+ *      sobre llaves aleatorias da entre 2.7 y 2.9 bits por llave con 10^3 llaves, entre 3.3 y 3.5
+ *      con 10^5 y alrededor de 3.6 con 10^6.
+ *
+ *      Cada llave del conjunto recibe una casilla distinta en [0, n), sin sondeo: una
+ *      consulta lee el piloto de su cubeta y calcula la casilla (y, para unas 3% de las
+ *      llaves, lee además su reubicación). Para una llave fuera del
+ *      conjunto también devuelve alguna casilla, así que quien la usa debe comparar la llave
+ *      guardada en esa casilla.
+ *
+ * Complejidad temporal:
+ *      O(1) por consulta; la construcción es O(n) en promedio.
+ */
+
+class PerfectHash{
+private:
+    static constexpr int BUCKET_LOAD = 5;
+    static constexpr int MAX_PILOT = 1 << 22;
+    static constexpr int MAX_SEEDS = 16;
+
+    typedef std::vector<std::uint64_t, TrackingAllocator<std::uint64_t, MemoryTag::HashTable>> PackedWords;
+
+    PackedWords pilotWords;
+    // Casilla en [0, n) de cada casilla sobrante [n, m) ocupada.
+    PackedWords remapWords;
+    std::uint64_t seed;
+    int numKeys;
+    int numSlots;
+    int numBuckets;
+    int pilotBits;
+    int remapBits;
+
+    /*
+     * Descripción: packedAt() / pack()
+     *      Leen un valor de un arreglo empacado con bits bits por valor, y empacan un arreglo
+     *      con los bits justos para su mayor valor.
+     *
+     * Parámetros de entrada:
+     *      @words: palabras del arreglo empacado.
+     *
+     *      @index: posición del valor.
+     *
+     *      @bits: bits por valor.
+     *
+     *      @values: valores a empacar.
+     *
+     * Valor de retorno:
+     *      packedAt() devuelve el valor; pack() no retorna ningún valor y guarda en bits el
+     *      ancho elegido.
+     *
+     * Complejidad temporal:
+     *      O(1) por valor.
+     */
+
+    static std::uint64_t packedAt(const PackedWords &words, int index, int bits);
+    static void pack(PackedWords &words, const std::vector<std::uint64_t> &values, int &bits);
+
+    /*
+     * Descripción: hashOf() / bucketOf() / slotOf()
+     *      Hash de 64 bits de una llave con la semilla actual, cubeta que le corresponde
+     *      (bits altos del hash) y casilla en [0, m) que ocupa con un piloto dado (el hash
+     *      mezclado con el hash del piloto). Ambos rangos se reducen con una multiplicación en
+     *      lugar de un módulo.
+     *
+     * Parámetros de entrada:
+     *      @key / @hash: llave o su hash.
+     *
+     *      @pilot: piloto de la cubeta.
+     *
+     * Valor de retorno:
+     *      Hash, cubeta o casilla correspondiente.
+     *
+     * Complejidad temporal:
+     *      O(1)
+     */
+
+    std::uint64_t hashOf(std::uint32_t key) const;
+    int bucketOf(std::uint64_t hash) const;
+    int slotOf(std::uint64_t hash, std::uint64_t pilot) const;
+
+    /*
+     * Descripción: tryBuild()
+     *      Intenta asignar pilotos a todas las cubetas con la semilla actual.
+     *
+     * Parámetros de entrada:
+     *      @keys: llaves del conjunto, sin repetir.
+     *
+     *      @count: número de llaves.
+     *
+     * Valor de retorno:
+     *      true si todas las cubetas recibieron un piloto, false si alguna agotó MAX_PILOT
+     *      intentos (hay que cambiar la semilla).
+     *
+     * Complejidad temporal:
+     *      O(n) en promedio.
+     */
+
+    bool tryBuild(const std::uint32_t *keys, int count);
+
+public:
+
+    /*
+     * Descripción:
+     *      Constructor de la función. Crea una función vacía, sin llaves.
+     *
+     * Parámetros de entrada:
+     *      No posee parámetros de entrada.
+     *
+     * Valor de retorno:
+     *      No retorna ningún valor.
+     *
+     * Complejidad temporal:
+     *      O(1)
+     */
+
+    PerfectHash();
+
+    /*
+     * Descripción: build()
+     *      Construye la función para el conjunto de llaves; si una semilla no funciona prueba
+     *      con otra. Lanza std::invalid_argument si no se logra con MAX_SEEDS semillas, lo
+     *      que en la práctica sólo ocurre con llaves repetidas.
+     *
+     * Parámetros de entrada:
+     *      @keys: llaves del conjunto, sin repetir.
+     *
+     *      @count: número de llaves.
+     *
+     * Valor de retorno:
+     *      No retorna ningún valor.
+     *
+     * Complejidad temporal:
+     *      O(n) en promedio.
+     */
+
+    void build(const std::uint32_t *keys, int count);
+
+    /*
+     * Descripción: find()
+     *      Devuelve la casilla de una llave.
+     *
+     * Parámetros de entrada:
+     *      @key: llave buscada.
+     *
+     * Valor de retorno:
+     *      Casilla en [0, n) si la llave pertenece al conjunto (distinta para cada llave), una
+     *      casilla arbitraria si no pertenece, o -1 si la función está vacía.
+     *
+     * Complejidad temporal:
+     *      O(1)
+     */
+
+    int find(std::uint32_t key) const;
+
+    /*
+     * Descripción: size() / getBitsPerKey()
+     *      Devuelven el número de llaves y los bits que ocupa la función por llave (pilotos y
+     *      tabla de reubicación).
+     *
+     * Parámetros de entrada:
+     *      No posee parámetros de entrada.
+     *
+     * Valor de retorno:
+     *      El valor correspondiente.
+     *
+     * Complejidad temporal:
+     *      O(1)
+     */
+
+    int size() const;
+    double getBitsPerKey() const;
+
+    /*
+     * Descripción: clear()
+     *      Libera los pilotos y deja la función vacía.
+     *
+     * Parámetros de entrada:
+     *      No posee parámetros de entrada.
+     *
+     * Valor de retorno:
+     *      No retorna ningún valor.
+     *
+     * Complejidad temporal:
+     *      O(1)
+     */
+
+    void clear();
+};
+
+inline PerfectHash::PerfectHash(){
+    seed = 0;
+    numKeys = 0;
+    numSlots = 0;
+    numBuckets = 0;
+    pilotBits = 1;
+    remapBits = 1;
+}
+
+inline std::uint64_t PerfectHash::packedAt(const PackedWords &words, int index, int bits){
+    std::uint64_t bit = (std::uint64_t)index * bits;
+    std::uint64_t word = bit >> 6;
+    int offset = (int)(bit & 63);
+    std::uint64_t value = words[word] >> offset;
+
+    if (offset + bits > 64){
+        value |= words[word + 1] << (64 - offset);
+    }
+
+    return value & ((1ull << bits) - 1);
+}
+
+inline void PerfectHash::pack(PackedWords &words, const std::vector<std::uint64_t> &values, int &bits){
+    std::uint64_t largest = 0;
+
+    for (std::uint64_t value : values){
+        largest = (value > largest) ? value : largest;
+    }
+
+    bits = 1;
+
+    while ((largest >> bits) != 0){
+        bits++;
+    }
+
+    words.assign(((std::uint64_t)values.size() * bits + 63) / 64 + 1, 0);
+
+    for (std::size_t k = 0; k < values.size(); k++){
+        std::uint64_t bit = (std::uint64_t)k * bits;
+        std::uint64_t word = bit >> 6;
+        int offset = (int)(bit & 63);
+        words[word] |= values[k] << offset;
+
+        if (offset + bits > 64){
+            words[word + 1] |= values[k] >> (64 - offset);
+        }
+    }
+}
+
+inline std::uint64_t PerfectHash::hashOf(std::uint32_t key) const{
+    return Mix64Hash::hash(key ^ (seed * 0x9E3779B97F4A7C15ull));
+}
+
+inline int PerfectHash::bucketOf(std::uint64_t hash) const{
+    return (int)(((hash >> 32) * (std::uint64_t)numBuckets) >> 32);
+}
+
+inline int PerfectHash::slotOf(std::uint64_t hash, std::uint64_t pilot) const{
+    // La multiplicación propaga a los bits altos las diferencias entre llaves que el xor con
+    // el piloto conserva; sin ella dos llaves que sólo difieren en bits bajos chocarían con
+    // cualquier piloto.
+    std::uint64_t mixed = ((hash ^ Mix64Hash::hash(pilot)) * 0x9E3779B97F4A7C15ull) >> 32;
+    return (int)((mixed * (std::uint64_t)numSlots) >> 32);
+}
+
+inline bool PerfectHash::tryBuild(const std::uint32_t *keys, int count){
+    std::vector<std::uint64_t> hashes(count);
+    std::vector<int> bucketStart(numBuckets + 1, 0);
+
+    for (int k = 0; k < count; k++){
+        hashes[k] = hashOf(keys[k]);
+        bucketStart[bucketOf(hashes[k]) + 1]++;
+    }
+
+    // Cubetas en orden de tamaño descendente, con sus hashes contiguos (ordenamiento por
+    // conteo en ambos casos).
+    int largest = 0;
+
+    for (int b = 0; b < numBuckets; b++){
+        largest = (bucketStart[b + 1] > largest) ? bucketStart[b + 1] : largest;
+        bucketStart[b + 1] += bucketStart[b];
+    }
+
+    std::vector<std::uint64_t> grouped(count);
+    std::vector<int> fill(bucketStart.begin(), bucketStart.end() - 1);
+
+    for (int k = 0; k < count; k++){
+        grouped[fill[bucketOf(hashes[k])]++] = hashes[k];
+    }
+
+    std::vector<int> sizeStart(largest + 2, 0);
+
+    for (int b = 0; b < numBuckets; b++){
+        sizeStart[largest - (bucketStart[b + 1] - bucketStart[b]) + 1]++;
+    }
+
+    for (int s = 0; s <= largest; s++){
+        sizeStart[s + 1] += sizeStart[s];
+    }
+
+    std::vector<int> order(numBuckets);
+
+    for (int b = 0; b < numBuckets; b++){
+        order[sizeStart[largest - (bucketStart[b + 1] - bucketStart[b])]++] = b;
+    }
+
+    std::vector<std::uint64_t> pilots(numBuckets, 0);
+    std::vector<char> taken(numSlots, 0);
+    std::vector<int> slots(largest);
+
+    for (int b : order){
+        int begin = bucketStart[b];
+        int end = bucketStart[b + 1];
+
+        if (begin == end){
+            break;
+        }
+
+        std::uint64_t pilot = 0;
+
+        for (; pilot < (std::uint64_t)MAX_PILOT; pilot++){
+            bool free = true;
+
+            for (int k = begin; k < end && free; k++){
+                int slot = slotOf(grouped[k], pilot);
+                free = !taken[slot];
+                slots[k - begin] = slot;
+
+                for (int j = begin; j < k && free; j++){
+                    free = (slots[j - begin] != slot);
+                }
+            }
+
+            if (free){
+                break;
+            }
+        }
+
+        if (pilot == (std::uint64_t)MAX_PILOT){
+            return false;
+        }
+
+        for (int k = begin; k < end; k++){
+            taken[slots[k - begin]] = 1;
+        }
+
+        pilots[b] = pilot;
+    }
+
+    // Hay tantos huecos en [0, n) como casillas ocupadas en [n, m); se emparejan en orden.
+    std::vector<std::uint64_t> remap(numSlots - count, 0);
+    int hole = 0;
+
+    for (int slot = count; slot < numSlots; slot++){
+
+        if (taken[slot]){
+
+            while (taken[hole]){
+                hole++;
+            }
+
+            remap[slot - count] = hole++;
+        }
+    }
+
+    pack(pilotWords, pilots, pilotBits);
+    pack(remapWords, remap, remapBits);
+    return true;
+}
+
+inline void PerfectHash::build(const std::uint32_t *keys, int count){
+    clear();
+    numKeys = count;
+    numSlots = count + count / 32 + 1;
+    numBuckets = (count + BUCKET_LOAD - 1) / BUCKET_LOAD;
+
+    if (count == 0){
+        return;
+    }
+
+    for (seed = 0; seed < (std::uint64_t)MAX_SEEDS; seed++){
+
+        if (tryBuild(keys, count)){
+            return;
+        }
+    }
+
+    clear();
+    throw std::invalid_argument("No se pudo construir el hash perfecto (llaves repetidas).");
+}
+
+inline int PerfectHash::find(std::uint32_t key) const{
+
+    if (numKeys == 0){
+        return -1;
+    }
+
+    std::uint64_t hash = hashOf(key);
+    int slot = slotOf(hash, packedAt(pilotWords, bucketOf(hash), pilotBits));
+    return (slot < numKeys) ? slot : (int)packedAt(remapWords, slot - numKeys, remapBits);
+}
+
+inline int PerfectHash::size() const{
+    return numKeys;
+}
+
+inline double PerfectHash::getBitsPerKey() const{
+    return (numKeys == 0) ? 0.0 : ((double)numBuckets * pilotBits + (double)(numSlots - numKeys) * remapBits) / numKeys;
+}
+
+inline void PerfectHash::clear(){
+    PackedWords().swap(pilotWords);
+    PackedWords().swap(remapWords);
+    seed = 0;
+    numKeys = 0;
+    numSlots = 0;
+    numBuckets = 0;
+    pilotBits = 1;
+    remapBits = 1;
+}
+
+#endif // _PERFECT_HASH_H_
@@ -0,0 +1,599 @@
+#ifndef _SWISS_HASH_TABLE_H_
+#define _SWISS_HASH_TABLE_H_
+
+#include <cstdint>
+#include <iostream>
+#include <stdexcept>
+#include <vector>
+#include "MemoryTracker.h"
+
+#if defined(__SSE2__) && !defined(SWISSTABLE_NO_SIMD)
+#include <emmintrin.h>
+#endif
+
+/*
+ * Descripción:
+ *      Tabla hash de direccionamiento abierto al estilo "Swiss table", con la misma interfaz
+ *      que HashTable. Las casillas se agrupan de 16 en 16 y cada casilla tiene un byte de
+ *      control en un arreglo aparte: vacío, borrado u ocupado con 7 bits del hash (h2). Una
+ *      búsqueda compara con SSE2 los 16 bytes de control del grupo contra h2 en una sola
+ *      instrucción y sólo lee las llaves de las casillas que coinciden, de modo que casi
+ *      siempre basta con una línea de caché de control y una de llaves. Las llaves y los
+ *      valores se guardan en arreglos planos separados, sin listas de desbordamiento. Los
+ *      grupos se recorren con sondeo triangular, que visita todos los grupos porque su
+ *      número es potencia de dos. Al compilar con -DSWISSTABLE_NO_SIMD se usa una
+ *      comparación escalar equivalente.
+ *
+ * Complejidad temporal:
+ *      O(1) en promedio por inserción, búsqueda y eliminación.
+ */
+
+template <class K, class T>
+class SwissHashTable{
+private:
+    static constexpr int GROUP_SIZE = 16;
+    static constexpr std::int8_t CTRL_EMPTY = -128;
+    static constexpr std::int8_t CTRL_DELETED = -2;
+
+    std::vector<std::int8_t, TrackingAllocator<std::int8_t, MemoryTag::HashTable>> control;
+    std::vector<K, TrackingAllocator<K, MemoryTag::HashTable>> keys;
+    std::vector<T, TrackingAllocator<T, MemoryTag::HashTable>> values;
+    int numGroups;
+    int numElements;
+    int numCollisions;
+    int maxSize;
+    bool autoGrow;
+
+    /*
+     * Descripción: hashOf()
+     *      Mezcla la llave con una multiplicación de 64 bits y un corrimiento, para que los
+     *      7 bits de h2 y los bits del grupo inicial dependan de todos los bits de la llave.
+     *
+     * Parámetros de entrada:
+     *      @keyValue: llave a dispersar.
+     *
+     * Valor de retorno:
+     *      Hash de 64 bits de la llave.
+     *
+     * Complejidad temporal:
+     *      O(1)
+     */
+
+    static std::uint64_t hashOf(K keyValue);
+
+    /*
+     * Descripción: matchGroup()
+     *      Compara los 16 bytes de control de un grupo contra un valor.
+     *
+     * Parámetros de entrada:
+     *      @group: índice del grupo.
+     *
+     *      @value: byte de control buscado.
+     *
+     * Valor de retorno:
+     *      Máscara de 16 bits con un 1 en cada casilla del grupo cuyo control es igual a value.
+     *
+     * Complejidad temporal:
+     *      O(1)
+     */
+
+    unsigned int matchGroup(int group, std::int8_t value) const;
+
+    /*
+     * Descripción: matchFree()
+     *      Obtiene las casillas vacías o borradas de un grupo (bit más alto encendido).
+     *
+     * Parámetros de entrada:
+     *      @group: índice del grupo.
+     *
+     * Valor de retorno:
+     *      Máscara de 16 bits con un 1 en cada casilla libre.
+     *
+     * Complejidad temporal:
+     *      O(1)
+     */
+
+    unsigned int matchFree(int group) const;
+
+    /*
+     * Descripción: lowestBit()
+     *      Devuelve la posición del bit encendido menos significativo de una máscara no vacía.
+     *
+     * Parámetros de entrada:
+     *      @mask: máscara distinta de cero.
+     *
+     * Valor de retorno:
+     *      Posición del bit, entre 0 y 15.
+     *
+     * Complejidad temporal:
+     *      O(1)
+     */
+
+    static int lowestBit(unsigned int mask);
+
+    /*
+     * Descripción: grow()
+     *      Duplica el número máximo de elementos y reinserta todos los elementos en los
+     *      arreglos nuevos. A diferencia de HashTable el traslado es completo, pero sólo
+     *      recorre los arreglos planos de control, llaves y valores.
+     *
+     * Parámetros de entrada:
+     *      No posee parámetros de entrada.
+     *
+     * Valor de retorno:
+     *      No retorna ningún valor.
+     *
+     * Complejidad temporal:
+     *      O(n) donde n es el número de casillas.
+     */
+
+    void grow();
+
+public:
+
+    /*
+     * Descripción:
+     *      Constructor de la tabla. Crea una tabla vacía sin casillas.
+     *
+     * Parámetros de entrada:
+     *      No posee parámetros de entrada.
+     *
+     * Valor de retorno:
+     *      No retorna ningún valor.
+     *
+     * Complejidad temporal:
+     *      O(1)
+     */
+
+    SwissHashTable();
+
+    /*
+     * Descripción:
+     *      Destructor de la tabla. Libera los arreglos de control, llaves y valores.
+     *
+     * Parámetros de entrada:
+     *      No posee parámetros de entrada.
+     *
+     * Valor de retorno:
+     *      No retorna ningún valor.
+     *
+     * Complejidad temporal:
+     *      O(n)
+     */
+
+    ~SwissHashTable();
+
+    /*
+     * Descripción: setMaxSize()
+     *      Vacía la tabla y la prepara para guardar hasta selectedMaxSize elementos. El número
+     *      de casillas se redondea a la potencia de dos (y múltiplo de 16) que mantiene el
+     *      factor de carga en 7/8 o menos.
+     *
+     * Parámetros de entrada:
+     *      @selectedMaxSize: número máximo de elementos.
+     *
+     * Valor de retorno:
+     *      No retorna ningún valor.
+     *
+     * Complejidad temporal:
+     *      O(n)
+     */
+
+    void setMaxSize(int selectedMaxSize);
+
+    /*
+     * Descripción: getHashIndex()
+     *      Calcula la primera casilla del grupo inicial de una llave.
+     *
+     * Parámetros de entrada:
+     *      @keyValue: llave a dispersar.
+     *
+     * Valor de retorno:
+     *      Índice de la primera casilla del grupo inicial.
+     *
+     * Complejidad temporal:
+     *      O(1)
+     */
+
+    int getHashIndex(K keyValue);
+
+    /*
+     * Descripción: getNumElements()
+     *      Devuelve el número de elementos almacenados.
+     *
+     * Parámetros de entrada:
+     *      No posee parámetros de entrada.
+     *
+     * Valor de retorno:
+     *      Número de elementos.
+     *
+     * Complejidad temporal:
+     *      O(1)
+     */
+
+    int getNumElements();
+
+    /*
+     * Descripción: print()
+     *      Imprime las casillas ocupadas con su llave y su valor.
+     *
+     * Parámetros de entrada:
+     *      No posee parámetros de entrada.
+     *
+     * Valor de retorno:
+     *      No retorna ningún valor.
+     *
+     * Complejidad temporal:
+     *      O(n) donde n es el número de casillas.
+     */
+
+    void print();
+
+    /*
+     * Descripción: add()
+     *      Agrega un elemento. Busca la llave en los grupos de su secuencia de sondeo y la
+     *      coloca en la primera casilla vacía o borrada. Lanza std::out_of_range si la tabla
+     *      está llena o si la llave ya existe.
+     *
+     * Parámetros de entrada:
+     *      @keyValue: llave del elemento.
+     *
+     *      @dataValue: valor asociado a la llave.
+     *
+     * Valor de retorno:
+     *      No retorna ningún valor.
+     *
+     * Complejidad temporal:
+     *      O(1) en promedio.
+     */
+
+    void add(K keyValue, T dataValue);
+
+    /*
+     * Descripción: find()
+     *      Busca una llave. En cada grupo compara h2 contra los 16 bytes de control y revisa
+     *      sólo las casillas que coinciden; la búsqueda termina en el primer grupo que tiene
+     *      una casilla vacía.
+     *
+     * Parámetros de entrada:
+     *      @keyValue: llave buscada.
+     *
+     * Valor de retorno:
+     *      Índice de la casilla de la llave, o -1 si no existe.
+     *
+     * Complejidad temporal:
+     *      O(1) en promedio.
+     */
+
+    int find(K keyValue);
+
+    /*
+     * Descripción: getDataAt()
+     *      Devuelve el valor guardado en una casilla.
+     *
+     * Parámetros de entrada:
+     *      @index: índice de la casilla, obtenido con find().
+     *
+     * Valor de retorno:
+     *      Valor de la casilla.
+     *
+     * Complejidad temporal:
+     *      O(1)
+     */
+
+    T getDataAt(int index);
+
+    /*
+     * Descripción: remove()
+     *      Elimina una llave marcando su casilla como borrada, para no cortar la secuencia de
+     *      sondeo de otras llaves. Lanza std::out_of_range si la llave no existe.
+     *
+     * Parámetros de entrada:
+     *      @keyValue: llave a eliminar.
+     *
+     * Valor de retorno:
+     *      No retorna ningún valor.
+     *
+     * Complejidad temporal:
+     *      O(1) en promedio.
+     */
+
+    void remove(K keyValue);
+
+    /*
+     * Descripción: getNumCollisions()
+     *      Devuelve el número de grupos adicionales al grupo inicial que se revisaron al
+     *      insertar, que es el equivalente de una colisión en esta tabla.
+     *
+     * Parámetros de entrada:
+     *      No posee parámetros de entrada.
+     *
+     * Valor de retorno:
+     *      Número de colisiones.
+     *
+     * Complejidad temporal:
+     *      O(1)
+     */
+
+    int getNumCollisions();
+
+    /*
+     * Descripción: setAutomaticSize()
+     *      Vacía la tabla y activa el crecimiento automático: cuando add() alcanza el número
+     *      máximo de elementos, la tabla duplica su tamaño en lugar de lanzar una excepción.
+     *
+     * Parámetros de entrada:
+     *      @expected: número de elementos esperado.
+     *
+     * Valor de retorno:
+     *      No retorna ningún valor.
+     *
+     * Complejidad temporal:
+     *      O(expected)
+     */
+
+    void setAutomaticSize(int expected);
+
+    /*
+     * Descripción: getCapacity()
+     *      Devuelve el número de casillas de la tabla.
+     *
+     * Parámetros de entrada:
+     *      No posee parámetros de entrada.
+     *
+     * Valor de retorno:
+     *      Número de casillas.
+     *
+     * Complejidad temporal:
+     *      O(1)
+     */
+
+    int getCapacity();
+};
+
+template <class K, class T>
+SwissHashTable<K, T>::SwissHashTable(){
+    numGroups = 0;
+    numElements = 0;
+    numCollisions = 0;
+    maxSize = 0;
+    autoGrow = false;
+}
+
+template <class K, class T>
+SwissHashTable<K, T>::~SwissHashTable(){
+    control.clear();
+    keys.clear();
+    values.clear();
+    numGroups = 0;
+    numElements = 0;
+    numCollisions = 0;
+    maxSize = 0;
+}
+
+template <class K, class T>
+void SwissHashTable<K, T>::setMaxSize(int selectedMaxSize){
+    int capacity = GROUP_SIZE;
+
+    while ((long long)capacity * 7 / 8 < selectedMaxSize){
+        capacity <<= 1;
+    }
+
+    numGroups = capacity / GROUP_SIZE;
+    maxSize = selectedMaxSize;
+    numElements = 0;
+    numCollisions = 0;
+    autoGrow = false;
+    control.assign(capacity, CTRL_EMPTY);
+    keys.assign(capacity, K());
+    values.assign(capacity, T());
+}
+
+template <class K, class T>
+void SwissHashTable<K, T>::setAutomaticSize(int expected){
+    setMaxSize(expected > GROUP_SIZE ? expected : GROUP_SIZE);
+    autoGrow = true;
+}
+
+template <class K, class T>
+int SwissHashTable<K, T>::getCapacity(){
+    return (int)control.size();
+}
+
+template <class K, class T>
+void SwissHashTable<K, T>::grow(){
+    decltype(control) oldControl;
+    decltype(keys) oldKeys;
+    decltype(values) oldValues;
+    oldControl.swap(control);
+    oldKeys.swap(keys);
+    oldValues.swap(values);
+    setMaxSize(2 * maxSize);
+    autoGrow = true;
+
+    for (std::size_t slot = 0; slot < oldControl.size(); slot++){
+
+        if (oldControl[slot] >= 0){
+            add(oldKeys[slot], oldValues[slot]);
+        }
+    }
+}
+
+template <class K, class T>
+std::uint64_t SwissHashTable<K, T>::hashOf(K keyValue){
+    std::uint64_t hash = (std::uint64_t)keyValue * 0x9E3779B97F4A7C15ull;
+    return hash ^ (hash >> 32);
+}
+
+template <class K, class T>
+unsigned int SwissHashTable<K, T>::matchGroup(int group, std::int8_t value) const{
+#if defined(__SSE2__) && !defined(SWISSTABLE_NO_SIMD)
+    __m128i bytes = _mm_loadu_si128((const __m128i *)(control.data() + group * GROUP_SIZE));
+    return (unsigned int)_mm_movemask_epi8(_mm_cmpeq_epi8(bytes, _mm_set1_epi8(value)));
+#else
+    unsigned int mask = 0;
+    const std::int8_t *bytes = control.data() + group * GROUP_SIZE;
+
+    for (int k = 0; k < GROUP_SIZE; k++){
+        mask |= (unsigned int)(bytes[k] == value) << k;
+    }
+
+    return mask;
+#endif
+}
+
+template <class K, class T>
+unsigned int SwissHashTable<K, T>::matchFree(int group) const{
+#if defined(__SSE2__) && !defined(SWISSTABLE_NO_SIMD)
+    // Los controles vacío y borrado son negativos; movemask toma el bit de signo de cada byte.
+    __m128i bytes = _mm_loadu_si128((const __m128i *)(control.data() + group * GROUP_SIZE));
+    return (unsigned int)_mm_movemask_epi8(bytes);
+#else
+    unsigned int mask = 0;
+    const std::int8_t *bytes = control.data() + group * GROUP_SIZE;
+
+    for (int k = 0; k < GROUP_SIZE; k++){
+        mask |= (unsigned int)(bytes[k] < 0) << k;
+    }
+
+    return mask;
+#endif
+}
+
+template <class K, class T>
+int SwissHashTable<K, T>::lowestBit(unsigned int mask){
+    int position = 0;
+
+    while ((mask & 1u) == 0){
+        mask >>= 1;
+        position++;
+    }
+
+    return position;
+}
+
+template <class K, class T>
+int SwissHashTable<K, T>::getHashIndex(K keyValue){
+
+    if (numGroups == 0){
+        return -1;
+    }
+
+    return (int)((hashOf(keyValue) >> 7) & (std::uint64_t)(numGroups - 1)) * GROUP_SIZE;
+}
+
+template <class K, class T>
+int SwissHashTable<K, T>::getNumElements(){
+    return numElements;
+}
+
+template <class K, class T>
+void SwissHashTable<K, T>::print(){
+    std::cout << "Contenido de la tabla hash" << std::endl;
+
+    for (int i = 0; i < (int)control.size(); i++){
+
+        if (control[i] >= 0){
+            std::cout << "Celda: " << i << " Key: " << keys[i] << ", Value: " << values[i] << std::endl;
+        }
+    }
+}
+
+template <class K, class T>
+void SwissHashTable<K, T>::add(K keyValue, T dataValue){
+
+    if (find(keyValue) != -1){
+        throw std::out_of_range("El elemento ya existe en la tabla hash");
+    }
+
+    if (numElements >= maxSize){
+
+        if (!autoGrow){
+            throw std::out_of_range("La hash table esta llena");
+        }
+
+        grow();
+    }
+
+    std::uint64_t hash = hashOf(keyValue);
+    int mask = numGroups - 1;
+    int group = (int)((hash >> 7) & (std::uint64_t)mask);
+
+    for (int step = 1; step <= numGroups; step++){
+        unsigned int free = matchFree(group);
+
+        if (free != 0){
+            int slot = group * GROUP_SIZE + lowestBit(free);
+            control[slot] = (std::int8_t)(hash & 0x7F);
+            keys[slot] = keyValue;
+            values[slot] = dataValue;
+            numElements++;
+            return;
+        }
+
+        numCollisions++;
+        group = (group + step) & mask;
+    }
+
+    throw std::out_of_range("La hash table esta llena");
+}
+
+template <class K, class T>
+int SwissHashTable<K, T>::find(K keyValue){
+
+    if (numGroups == 0){
+        return -1;
+    }
+
+    std::uint64_t hash = hashOf(keyValue);
+    std::int8_t tag = (std::int8_t)(hash & 0x7F);
+    int mask = numGroups - 1;
+    int group = (int)((hash >> 7) & (std::uint64_t)mask);
+
+    for (int step = 1; step <= numGroups; step++){
+        unsigned int candidates = matchGroup(group, tag);
+
+        while (candidates != 0){
+            int slot = group * GROUP_SIZE + lowestBit(candidates);
+
+            if (keys[slot] == keyValue){
+                return slot;
+            }
+
+            candidates &= candidates - 1;
+        }
+
+        if (matchGroup(group, CTRL_EMPTY) != 0){
+            return -1;
+        }
+
+        group = (group + step) & mask;
+    }
+
+    return -1;
+}
+
+template <class K, class T>
+T SwissHashTable<K, T>::getDataAt(int index){
+    return values[index];
+}
+
+template <class K, class T>
+void SwissHashTable<K, T>::remove(K keyValue){
+    int pos = find(keyValue);
+
+    if (pos == -1){
+        throw std::out_of_range("El elemento no existe en la tabla hash");
+    }
+
+    control[pos] = CTRL_DELETED;
+    values[pos] = T();
+    numElements--;
+}
+
+template <class K, class T>
+int SwissHashTable<K, T>::getNumCollisions(){
+    return numCollisions;
+}
+
+#endif // _SWISS_HASH_TABLE_H_
@@ -0,0 +1,543 @@
+#ifndef _THREAD_POOL_H_
+#define _THREAD_POOL_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdlib>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "PerfCounters.h"
+
+class ThreadPool{
+private:
+    struct WorkQueue{
+        std::deque<std::function<void()>> tasks;
+        std::mutex queueMutex;
+    };
+
+    std::vector<std::unique_ptr<WorkQueue>> queues;
+    std::vector<std::thread> workers;
+    std::mutex sleepMutex;
+    std::condition_variable wakeUp;
+    std::atomic<int> queuedTasks;
+    std::atomic<unsigned int> nextQueue;
+    bool stopping;
+    int numThreads;
+
+    /*
+     * Descripción: currentWorker()
+     *      Devuelve el índice de la cola del hilo actual dentro del pool, o -1 si
+     *      el hilo no pertenece al pool (por ejemplo, el hilo principal).
+     *
+     * Parámetros de entrada:
+     *      No posee parámetros de entrada.
+     *
+     * Valor de retorno:
+     *      Referencia al índice del hilo actual.
+     *
+     * Complejidad temporal:
+     *      O(1)
+     */
+
+    static int &currentWorker();
+
+    /*
+     * Descripción: popTask()
+     *      Obtiene una tarea pendiente. El hilo dueño de una cola toma la tarea más
+     *      reciente del final de su cola (LIFO) y, si está vacía, roba la tarea más
+     *      antigua del frente de las colas de los demás hilos (FIFO).
+     *
+     * Parámetros de entrada:
+     *      @index: índice de la cola propia, o -1 si el hilo no tiene cola.
+     *
+     *      @task: referencia donde se guarda la tarea obtenida.
+     *
+     * Valor de retorno:
+     *      true si se obtuvo una tarea, false si todas las colas están vacías.
+     *
+     * Complejidad temporal:
+     *      O(h), donde h es el número de hilos del pool.
+     */
+
+    bool popTask(int index, std::function<void()> &task);
+
+    /*
+     * Descripción: workerLoop()
+     *      Ciclo principal de cada hilo trabajador: ejecuta tareas propias o robadas y
+     *      duerme cuando no hay tareas pendientes.
+     *
+     * Parámetros de entrada:
+     *      @index: índice de la cola del hilo trabajador.
+     *
+     * Valor de retorno:
+     *      No retorna ningún valor.
+     *
+     * Complejidad temporal:
+     *      O(t) por el total de tareas t que ejecute el hilo.
+     */
+
+    void workerLoop(int index);
+
+public:
+
+    /*
+     * Descripción:
+     *      Constructor del pool. Crea _numThreads - 1 hilos trabajadores, ya que el hilo
+     *      que espera a un grupo de tareas también ejecuta tareas mientras espera.
+     *
+     * Parámetros de entrada:
+     *      @_numThreads: número total de hilos que participan en el trabajo paralelo.
+     *
+     * Valor de retorno:
+     *      No retorna ningún valor.
+     *
+     * Complejidad temporal:
+     *      O(h), donde h es el número de hilos.
+     */
+
+    ThreadPool(int _numThreads);
+
+    /*
+     * Descripción:
+     *      Destructor del pool. Despierta a los hilos trabajadores, les indica que
+     *      terminen y espera a que concluyan.
+     *
+     * Parámetros de entrada:
+     *      No posee parámetros de entrada.
+     *
+     * Valor de retorno:
+     *      No retorna ningún valor.
+     *
+     * Complejidad temporal:
+     *      O(h), donde h es el número de hilos.
+     */
+
+    ~ThreadPool();
+
+    /*
+     * Descripción: getInstance()
+     *      Devuelve el pool compartido por todo el programa. El número de hilos se toma
+     *      de la variable de entorno BITACORA_HILOS o, si no existe, del número de
+     *      núcleos disponibles.
+     *
+     * Parámetros de entrada:
+     *      No posee parámetros de entrada.
+     *
+     * Valor de retorno:
+     *      Referencia al pool compartido.
+     *
+     * Complejidad temporal:
+     *      O(h) la primera vez, O(1) después.
+     */
+
+    static ThreadPool &getInstance();
+
+    /*
+     * Descripción: getNumThreads()
+     *      Devuelve el número total de hilos que participan en el trabajo paralelo.
+     *
+     * Parámetros de entrada:
+     *      No posee parámetros de entrada.
+     *
+     * Valor de retorno:
+     *      Número de hilos.
+     *
+     * Complejidad temporal:
+     *      O(1)
+     */
+
+    int getNumThreads();
+
+    /*
+     * Descripción: submit()
+     *      Encola una tarea. Si la invoca un hilo del pool la tarea va a su propia cola;
+     *      si la invoca otro hilo, se reparte entre las colas de los trabajadores.
+     *
+     * Parámetros de entrada:
+     *      @task: función sin parámetros que se ejecutará en algún hilo del pool.
+     *
+     * Valor de retorno:
+     *      No retorna ningún valor.
+     *
+     * Complejidad temporal:
+     *      O(1)
+     */
+
+    void submit(std::function<void()> task);
+
+    /*
+     * Descripción: runPendingTask()
+     *      Ejecuta en el hilo actual una tarea pendiente, si existe. Se usa para que los
+     *      hilos que esperan a un grupo de tareas ayuden en lugar de bloquearse.
+     *
+     * Parámetros de entrada:
+     *      No posee parámetros de entrada.
+     *
+     * Valor de retorno:
+     *      true si se ejecutó una tarea, false si no había tareas pendientes.
+     *
+     * Complejidad temporal:
+     *      O(h) más el costo de la tarea ejecutada.
+     */
+
+    bool runPendingTask();
+
+    /*
+     * Descripción: waitForWork()
+     *      Bloquea el hilo actual hasta que done() sea verdadero o haya tareas pendientes
+     *      en el pool. done() se evalúa con el mutex del pool tomado, por lo que quien
+     *      lo vuelva verdadero debe avisar con notifyWaiters().
+     *
+     * Parámetros de entrada:
+     *      @done: función sin parámetros que indica si el hilo ya puede continuar.
+     *
+     * Valor de retorno:
+     *      No retorna ningún valor.
+     *
+     * Complejidad temporal:
+     *      O(1) más el tiempo de espera.
+     */
+
+    template <class Predicate>
+    void waitForWork(Predicate done);
+
+    /*
+     * Descripción: notifyWaiters()
+     *      Despierta a los hilos bloqueados en waitForWork() para que revisen su condición.
+     *
+     * Parámetros de entrada:
+     *      No posee parámetros de entrada.
+     *
+     * Valor de retorno:
+     *      No retorna ningún valor.
+     *
+     * Complejidad temporal:
+     *      O(h), donde h es el número de hilos bloqueados.
+     */
+
+    void notifyWaiters();
+};
+
+/*
+ * Descripción:
+ *      Grupo de tareas de tipo fork/join. run() lanza una tarea en el pool y wait()
+ *      espera a que terminen todas las tareas del grupo, ejecutando tareas pendientes
+ *      mientras tanto y bloqueándose en el pool cuando no hay ninguna. Si alguna tarea
+ *      lanza una excepción, wait() la vuelve a lanzar.
+ *      Con un solo hilo las tareas se ejecutan de inmediato en el hilo que las lanza.
+ *
+ * Complejidad temporal:
+ *      O(1) por tarea lanzada.
+ */
+
+class TaskGroup{
+private:
+    ThreadPool &pool;
+    std::atomic<int> pending;
+    std::mutex errorMutex;
+    std::exception_ptr error;
+
+    void storeError(std::exception_ptr e);
+
+public:
+    TaskGroup(ThreadPool &_pool = ThreadPool::getInstance());
+    ~TaskGroup();
+
+    template <class Function>
+    void run(Function task);
+
+    void wait();
+};
+
+/*
+ * Descripción: parallelFor()
+ *      Divide el rango [begin, end) en bloques de al menos grain elementos y ejecuta
+ *      body(inicio, fin) para cada bloque en el pool, dividiendo el rango a la mitad
+ *      de forma recursiva para que los hilos libres puedan robar las mitades.
+ *
+ * Parámetros de entrada:
+ *      @begin: primer índice del rango.
+ *
+ *      @end: índice siguiente al último del rango.
+ *
+ *      @grain: tamaño mínimo de un bloque.
+ *
+ *      @body: función que recibe el inicio y el fin de cada bloque.
+ *
+ * Valor de retorno:
+ *      No retorna ningún valor.
+ *
+ * Complejidad temporal:
+ *      O(n / h + log n) para n elementos y h hilos, más el costo de body.
+ */
+
+template <class Function>
+void parallelFor(int begin, int end, int grain, const Function &body, ThreadPool &pool = ThreadPool::getInstance());
+
+inline ThreadPool::ThreadPool(int _numThreads){
+    numThreads = (_numThreads < 1) ? 1 : _numThreads;
+    queuedTasks = 0;
+    nextQueue = 0;
+    stopping = false;
+
+    for (int i = 0; i < numThreads - 1; i++){
+        queues.push_back(std::unique_ptr<WorkQueue>(new WorkQueue()));
+    }
+
+    for (int i = 0; i < numThreads - 1; i++){
+        workers.push_back(std::thread(&ThreadPool::workerLoop, this, i));
+    }
+}
+
+inline ThreadPool::~ThreadPool(){
+    {
+        std::lock_guard<std::mutex> lock(sleepMutex);
+        stopping = true;
+    }
+
+    wakeUp.notify_all();
+
+    for (std::thread &worker : workers){
+        worker.join();
+    }
+}
+
+inline ThreadPool &ThreadPool::getInstance(){
+    static ThreadPool instance([](){
+        const char *value = std::getenv("BITACORA_HILOS");
+        int requested = (value != nullptr) ? std::atoi(value) : 0;
+        int available = (int)std::thread::hardware_concurrency();
+        return (requested > 0) ? requested : (available > 0 ? available : 1);
+    }());
+
+    return instance;
+}
+
+inline int &ThreadPool::currentWorker(){
+    static thread_local int index = -1;
+    return index;
+}
+
+inline int ThreadPool::getNumThreads(){
+    return numThreads;
+}
+
+inline void ThreadPool::submit(std::function<void()> task){
+    int index = currentWorker();
+
+    if (index < 0){
+        index = (int)(nextQueue.fetch_add(1, std::memory_order_relaxed) % queues.size());
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(queues[index]->queueMutex);
+        queues[index]->tasks.push_back(std::move(task));
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(sleepMutex);
+        queuedTasks++;
+    }
+
+    wakeUp.notify_one();
+}
+
+inline bool ThreadPool::popTask(int index, std::function<void()> &task){
+
+    if (index >= 0){
+        std::lock_guard<std::mutex> lock(queues[index]->queueMutex);
+
+        if (!queues[index]->tasks.empty()){
+            task = std::move(queues[index]->tasks.back());
+            queues[index]->tasks.pop_back();
+            queuedTasks--;
+            return true;
+        }
+    }
+
+    int numQueues = (int)queues.size();
+    int start = (index >= 0) ? index + 1 : (int)(nextQueue.load(std::memory_order_relaxed) % (unsigned int)(numQueues > 0 ? numQueues : 1));
+
+    for (int k = 0; k < numQueues; k++){
+        int victim = (start + k) % numQueues;
+
+        if (victim == index){
+            continue;
+        }
+
+        std::lock_guard<std::mutex> lock(queues[victim]->queueMutex);
+
+        if (!queues[victim]->tasks.empty()){
+            task = std::move(queues[victim]->tasks.front());
+            queues[victim]->tasks.pop_front();
+            queuedTasks--;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+inline void ThreadPool::workerLoop(int index){
+    currentWorker() = index;
+
+    // Con BITACORA_PERF los contadores de cada trabajador se suman a la fase que lo ocupa.
+    if (PerfCounters::getInstance().isEnabled()){
+        PerfCounters::getInstance().attachThread();
+    }
+
+    std::function<void()> task;
+
+    while (true){
+
+        if (popTask(index, task)){
+            task();
+            task = nullptr;
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(sleepMutex);
+        wakeUp.wait(lock, [this](){ return stopping || queuedTasks > 0; });
+
+        if (stopping && queuedTasks <= 0){
+            return;
+        }
+    }
+}
+
+inline bool ThreadPool::runPendingTask(){
+    std::function<void()> task;
+
+    if (popTask(currentWorker(), task)){
+        task();
+        return true;
+    }
+
+    return false;
+}
+
+template <class Predicate>
+void ThreadPool::waitForWork(Predicate done){
+    std::unique_lock<std::mutex> lock(sleepMutex);
+    wakeUp.wait(lock, [this, &done](){ return done() || queuedTasks > 0; });
+}
+
+inline void ThreadPool::notifyWaiters(){
+    // Tomar el mutex asegura que ningún hilo quede entre revisar su condición y dormirse.
+    {
+        std::lock_guard<std::mutex> lock(sleepMutex);
+    }
+
+    wakeUp.notify_all();
+}
+
+inline TaskGroup::TaskGroup(ThreadPool &_pool) : pool(_pool){
+    pending = 0;
+}
+
+inline TaskGroup::~TaskGroup(){
+
+    try{
+        wait();
+    }
+
+    catch (...){
+    }
+}
+
+inline void TaskGroup::storeError(std::exception_ptr e){
+    std::lock_guard<std::mutex> lock(errorMutex);
+
+    if (!error){
+        error = e;
+    }
+}
+
+template <class Function>
+void TaskGroup::run(Function task){
+
+    if (pool.getNumThreads() <= 1){
+
+        try{
+            task();
+        }
+
+        catch (...){
+            storeError(std::current_exception());
+        }
+
+        return;
+    }
+
+    pending++;
+    ThreadPool *owner = &pool;
+    pool.submit([this, owner, task](){
+
+        try{
+            task();
+        }
+
+        catch (...){
+            storeError(std::current_exception());
+        }
+
+        // Tras llegar a cero el grupo puede destruirse, por lo que ya no se usa this.
+        if (--pending == 0){
+            owner->notifyWaiters();
+        }
+    });
+}
+
+inline void TaskGroup::wait(){
+
+    while (pending > 0){
+
+        if (!pool.runPendingTask()){
+            pool.waitForWork([this](){ return pending <= 0; });
+        }
+    }
+
+    std::exception_ptr e;
+
+    {
+        std::lock_guard<std::mutex> lock(errorMutex);
+        e = error;
+        error = nullptr;
+    }
+
+    if (e){
+        std::rethrow_exception(e);
+    }
+}
+
+template <class Function>
+void parallelFor(int begin, int end, int grain, const Function &body, ThreadPool &pool){
+
+    if (grain < 1){
+        grain = 1;
+    }
+
+    if (end - begin <= grain || pool.getNumThreads() <= 1){
+
+        if (begin < end){
+            body(begin, end);
+        }
+
+        return;
+    }
+
+    int middle = begin + (end - begin) / 2;
+    TaskGroup group(pool);
+    group.run([begin, middle, grain, &body, &pool](){
+        parallelFor(begin, middle, grain, body, pool);
+    });
+    parallelFor(middle, end, grain, body, pool);
+    group.wait();
+}
+
+#endif // _THREAD_POOL_H_
@@ -19,14 +19,42 @@
  *     Viernes, 28 de julio de 2023
  *
  * Compilacion para debug:
- *    g++ -std=c++17 -g -o main *.cpp
+ *    g++ -std=c++17 -pthread -g -o main *.cpp
  * Ejecucion con valgrind:
  *    nix-env -iA nixpkgs.valgrind
  *    valgrind --leak-check=full ./main
  * Compilacion para ejecucion:
- *    g++ -std=c++17 -O3 -o main *.cpp
+ *    g++ -std=c++17 -pthread -O3 -o main *.cpp
  * Ejecucion:
  *    ./main
+ * Ejecucion con traza de etapas (chrome://tracing o Perfetto):
+ *    BITACORA_TRAZA=traza.json ./main
+ * Ejecucion con contadores de hardware por fase (Linux):
+ *    BITACORA_PERF=1 ./main
+ * Ejecucion con reporte de memoria por subsistema:
+ *    BITACORA_MEM=1 ./main
+ * Numero de hilos para las etapas paralelas (por omision, los nucleos disponibles):
+ *    BITACORA_HILOS=4 ./main
+ * Ejecucion con snapshot del grafo (se crea la primera vez y se mapea en las siguientes):
+ *    BITACORA_SNAPSHOT=grafo.snap ./main
+ * Ejecucion con imagen de la tabla hash (se crea la primera vez y se mapea en las siguientes):
+ *    BITACORA_IMAGEN_HASH=tabla.img ./main
+ * Ejecucion con lista de adyacencia comprimida (grafos muy grandes):
+ *    BITACORA_COMPRIMIR=1 ./main
+ * Ejecucion con conexiones repetidas agregadas (una fila por direccion vecina):
+ *    BITACORA_AGREGAR=1 ./main
+ * Motor de la tabla hash de direcciones (cuadratica por omision, fibonacci, mix64, segura, swiss, cuckoo o
+ * concurrente):
+ *    BITACORA_TABLA=segura ./main
+ *    BITACORA_TABLA=swiss ./main
+ *    BITACORA_TABLA=cuckoo ./main
+ *    BITACORA_TABLA=concurrente BITACORA_HILOS=4 ./main
+ * Consultas con un hash perfecto minimo de las IP cargadas:
+ *    BITACORA_HASH_PERFECTO=1 ./main
+ * Histogramas de sondeo y ocupacion de la tabla hash junto con las colisiones:
+ *    BITACORA_ESTADISTICAS=1 ./main
+ * Comparacion de politicas de hash y tamano de la tabla con las IP cargadas:
+ *    BITACORA_REPORTE_HASH=1 ./main
  *
  * Código de Replit:
  *  https://replit.com/join/srjndjmlql-alyson-melissa1